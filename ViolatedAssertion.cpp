@@ -13,10 +13,18 @@ using namespace std;
 
 ViolatedAssertion::ViolatedAssertion() {
 	cout << "An assertion has been violated" << endl;
+	message="An assertion has been violated";
 }
 		
 
 ViolatedAssertion::ViolatedAssertion(string error_message) {
 	cout << "An assertion has been violated" << endl;
 	cout << error_message << endl;
+	message=error_message;
+}
+
+
+// Message that the exception was thrown with
+string ViolatedAssertion::get_message() {
+	return message;
 }
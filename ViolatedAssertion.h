@@ -14,4 +14,9 @@ class ViolatedAssertion {
 	public:
 		ViolatedAssertion();		
 		ViolatedAssertion(string error_message);
+		// Message that the exception was thrown with
+		string get_message();
+
+	private:
+		string message;
 };
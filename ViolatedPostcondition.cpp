@@ -10,10 +10,18 @@ using namespace std;
 
 ViolatedPostcondition::ViolatedPostcondition() {
 	cout << "An postcondition has been violated" << endl;
+	message="An postcondition has been violated";
 }
 		
 
 ViolatedPostcondition::ViolatedPostcondition(string error_message) {
 	cout << "An postcondition has been violated" << endl;
 	cout << error_message << endl;
+	message=error_message;
+}
+
+
+// Message that the exception was thrown with
+string ViolatedPostcondition::get_message() {
+	return message;
 }
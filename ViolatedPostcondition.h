@@ -11,4 +11,9 @@ class ViolatedPostcondition {
 	public:
 		ViolatedPostcondition();		
 		ViolatedPostcondition(string error_message);
+		// Message that the exception was thrown with
+		string get_message();
+
+	private:
+		string message;
 };
@@ -10,10 +10,18 @@ using namespace std;
 
 ViolatedPrecondition::ViolatedPrecondition() {
 	cout << "An precondition has been violated" << endl;
+	message="An precondition has been violated";
 }
 		
 
 ViolatedPrecondition::ViolatedPrecondition(string error_message) {
 	cout << "An precondition has been violated" << endl;
 	cout << error_message << endl;
+	message=error_message;
+}
+
+
+// Message that the exception was thrown with
+string ViolatedPrecondition::get_message() {
+	return message;
 }
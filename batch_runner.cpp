@@ -0,0 +1,275 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Runner of a batch of STIL files in a single process; see batch_runner.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #Instances of file_analyzer share no state, so that different files can
+ *	be parsed on different threads at the same time
+ * #The trace that file_analyzer prints on the standard output is of no use
+ *	for a batch; it is suppressed whilst the batch runs, since the traces
+ *	of the files would interleave
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "batch_runner.h"
+#include "thread_pool.h"
+#include "trace_events.h"
+#include "ViolatedAssertion.h"
+#include "ViolatedPostcondition.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// =======================================================================
+
+// Standard constructor
+batch_runner::batch_runner(string output_directory, string output_extension) {
+	output_dir=output_directory;
+	output_ext=output_extension;
+	total_seconds=0;
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to add the STIL files of a list file, or of a directory
+ * A list file names a STIL file on each line; empty lines, and lines that
+ * start with "#", are skipped. Of a directory, every regular file that is
+ * not hidden is added, in the order of their names.
+ * @param list_or_directory is the name of the list file or directory
+ * @throws ViolatedPrecondition exception if it does not exist
+ * @return nothing
+ */
+void batch_runner::add_inputs(string list_or_directory) {
+	struct stat st;
+	if(stat(list_or_directory.c_str(), &st) != 0) {
+		cerr << "List of STIL files, " << list_or_directory
+			<< ", does not exist!" << endl;
+		throw ViolatedPrecondition("Invalid file name");
+	}
+
+	if(S_ISDIR(st.st_mode)) {
+		DIR *dir=opendir(list_or_directory.c_str());
+		if(dir == NULL) {
+			throw ViolatedPrecondition("Directory cannot be read");
+		}
+		vector<string> names;
+		struct dirent *entry;
+		while((entry=readdir(dir)) != NULL) {
+			string name=entry->d_name;
+			string path=list_or_directory+"/"+name;
+			if((name[0] != '.') && (stat(path.c_str(), &st) == 0)
+				&& S_ISREG(st.st_mode)) {
+
+				names.push_back(path);
+			}
+		}
+		closedir(dir);
+		sort(names.begin(), names.end());
+		for(size_t i=0; i<names.size(); i++) {
+			add_input(names[i]);
+		}
+		return;
+	}
+
+	ifstream list(list_or_directory.c_str());
+	string line;
+	while(getline(list, line)) {
+		// Trim the whitespace around the name
+		size_t first=line.find_first_not_of(" \t\r");
+		if((first == string::npos) || (line[first] == '#')) {
+			continue;
+		}
+		size_t last=line.find_last_not_of(" \t\r");
+		add_input(line.substr(first, last-first+1));
+	}
+}
+
+
+/**
+ * Function to add a STIL file to the batch
+ * @param input_filename is the name of the STIL file
+ * @return nothing
+ */
+void batch_runner::add_input(string input_filename) {
+	batch_job job;
+	job.input=input_filename;
+	job.output=output_filename(input_filename);
+	struct stat st;
+	job.size=(stat(input_filename.c_str(), &st) == 0) ? st.st_size : 0;
+	job.ok=false;
+	job.message="Not run";
+	job.seconds=0;
+	jobs.push_back(job);
+}
+
+
+/**
+ * Function to name the output file of a STIL file: its base name, without
+ * its extension, in the output directory
+ * A number is appended if that name is already taken in the batch
+ * @param input_filename is the name of the STIL file
+ * @return the name of the output file
+ */
+string batch_runner::output_filename(string input_filename) {
+	string base=input_filename;
+	size_t slash=base.rfind('/');
+	if(slash != string::npos) {
+		base=base.substr(slash+1);
+	}
+	size_t dot=base.rfind('.');
+	if((dot != string::npos) && (dot > 0)) {
+		base=base.substr(0, dot);
+	}
+
+	string name=output_dir+"/"+base+output_ext;
+	for(int n=1; ; n++) {
+		bool taken=false;
+		for(size_t i=0; i<jobs.size(); i++) {
+			if(jobs[i].output == name) {
+				taken=true;
+			}
+		}
+		if(!taken) {
+			return name;
+		}
+		name=output_dir+"/"+base+"_"+to_string(n)+output_ext;
+	}
+}
+
+
+// Number of files in the batch
+size_t batch_runner::get_num_jobs() {
+	return jobs.size();
+}
+
+
+// Function to set the function that applies the options to each file
+void batch_runner::set_configure(function<void(file_analyzer &)> f) {
+	configure=f;
+}
+
+
+/**
+ * Function to parse the file of a job, and to record its status
+ * The failure of a file is recorded; it does not stop the batch
+ * @param j is the index of the job
+ * @return nothing
+ */
+void batch_runner::run_job(size_t j) {
+	batch_job &job=jobs[j];
+	chrono::steady_clock::time_point start=chrono::steady_clock::now();
+	// The file is named on the timeline without its directory
+	string name=job.input.substr(job.input.find_last_of('/')+1);
+	trace_events::scope event("file", name.c_str());
+	try {
+		file_analyzer fa(job.input, job.output);
+		if(configure) {
+			configure(fa);
+		}
+		fa.parse_input();
+		job.ok=true;
+		job.message="";
+	}catch(ViolatedAssertion &e) {
+		job.message=e.get_message();
+	}catch(ViolatedPrecondition &e) {
+		job.message=e.get_message();
+	}catch(ViolatedPostcondition &e) {
+		job.message=e.get_message();
+	}catch(exception &e) {
+		job.message=e.what();
+	}catch(...) {
+		job.message="Unknown exception";
+	}
+	job.seconds=chrono::duration<double>(chrono::steady_clock::now()-start)
+		.count();
+}
+
+
+/**
+ * Function to parse all files of the batch
+ * Each job of the pool parses the largest file that has not been started,
+ * so that the files are started from the largest to the smallest, whichever
+ * worker runs or steals the job.
+ * @param num_threads is the number of threads
+ * @return the number of files that failed
+ * O(n log n) computational time complexity to order the n files
+ */
+int batch_runner::run(int num_threads) {
+	// Order of the jobs, from the largest file to the smallest
+	vector<size_t> order;
+	for(size_t i=0; i<jobs.size(); i++) {
+		order.push_back(i);
+	}
+	stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+		return jobs[a].size > jobs[b].size;
+	});
+
+	// Suppress the trace of the files on the standard output
+	cout.flush();
+	ios::iostate state=cout.rdstate();
+	cout.setstate(ios::failbit);
+
+	chrono::steady_clock::time_point start=chrono::steady_clock::now();
+	{
+		thread_pool pool(num_threads);
+		atomic<size_t> next(0);
+		for(size_t i=0; i<order.size(); i++) {
+			pool.submit([this, &order, &next] {
+				run_job(order[next++]);
+			});
+		}
+		pool.wait();
+	}
+	total_seconds=chrono::duration<double>(chrono::steady_clock::now()-start)
+		.count();
+	cout.clear(state);
+
+	int failed=0;
+	for(size_t i=0; i<jobs.size(); i++) {
+		if(!jobs[i].ok) {
+			failed++;
+		}
+	}
+	return failed;
+}
+
+
+/**
+ * Function to print the status of each file, in the order that they were
+ * added, followed by the totals of the batch
+ * @param out is the stream that the summary is printed to
+ * @return nothing
+ */
+void batch_runner::print_summary(ostream &out) {
+	int failed=0;
+	uint64_t bytes=0;
+	out << "Status\tSeconds\tBytes\tInput\tOutput\tMessage" << endl;
+	for(size_t i=0; i<jobs.size(); i++) {
+		const batch_job &job=jobs[i];
+		out << (job.ok ? "OK" : "FAILED") << "\t" << fixed << setprecision(3)
+			<< job.seconds << "\t" << job.size << "\t" << job.input << "\t"
+			<< job.output << "\t" << job.message << endl;
+		if(!job.ok) {
+			failed++;
+		}
+		bytes=bytes+job.size;
+	}
+	out << "Files: " << jobs.size() << "; failed: " << failed << "; bytes: "
+		<< bytes << "; seconds: " << fixed << setprecision(3) << total_seconds
+		<< endl;
+}
@@ -0,0 +1,82 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Runner of a batch of STIL files in a single process
+ * Each file is parsed by its own file_analyzer, as a job of a thread pool
+ * with work stealing; the largest files are started first, so that the
+ * longest jobs do not hold up the end of the batch.
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <stdint.h>
+
+#include "file_analyzer.h"
+
+
+#ifndef __BATCH_RUNNER_H
+#define __BATCH_RUNNER_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class batch_runner {
+	public:
+		// Standard Constructor...
+		batch_runner(string output_directory, string output_extension);
+
+		// Define headers for functions...
+		/**
+		 * Add the STIL files that are named in a list file, one on each
+		 * line, or that are in a directory
+		 */
+		void add_inputs(string list_or_directory);
+		// Add a STIL file
+		void add_input(string input_filename);
+		// Number of files in the batch
+		size_t get_num_jobs();
+		/**
+		 * Set the function that applies the options to the file_analyzer
+		 * of each file, before it is parsed
+		 */
+		void set_configure(function<void(file_analyzer &)> f);
+		/**
+		 * Parse all files on num_threads threads
+		 * @return the number of files that failed
+		 */
+		int run(int num_threads);
+		// Print the status of each file, and the totals of the batch
+		void print_summary(ostream &out);
+
+
+	private:
+		// File of the batch, and its status
+		struct batch_job {
+			string input;
+			string output;
+			uint64_t size;
+			bool ok;
+			string message;
+			double seconds;
+		};
+
+		// Declaration of instance variables...
+		string output_dir;
+		string output_ext;
+		vector<batch_job> jobs;
+		function<void(file_analyzer &)> configure;
+		// Time that the batch took, in seconds
+		double total_seconds;
+
+		// Parse the file of a job
+		void run_job(size_t j);
+		// Name of the output file of an input file
+		string output_filename(string input_filename);
+};
+#endif
@@ -0,0 +1,177 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Compiled STIL file; see compiled_stil.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #Once compile() has returned, nothing changes the compiled file, until
+ *	it is destroyed; the runs that share it only read it
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <thread>
+#include <exception>
+
+#include "compiled_stil.h"
+#include "spsc_ring.h"
+#include "mem_stats.h"
+#include "trace_events.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// =======================================================================
+
+// Default constructor
+compiled_stil::compiled_stil() {
+	in_file="";
+	compiled=false;
+}
+
+/**
+ * Standard constructor
+ * @param input_filename is the name of the STIL file
+ * @throws ViolatedPrecondition exception if the input file does not exist
+ */
+compiled_stil::compiled_stil(string input_filename) {
+	in_file=input_filename;
+	compiled=false;
+	inputfile.open(in_file.c_str());
+	// Assertion to check if the input file exist
+	if(!inputfile) {
+		cerr << "Input file, with the filename " << in_file
+			<< ", does not exist!" << endl;
+		throw ViolatedPrecondition("Invalid file name");
+	}
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to compile the input file: to read its tokens, and to close it
+ * Compiling a compiled file does nothing
+ * @param pipelined is true if the input file is lexed on its own thread
+ * @throws the exception that was thrown by the lexer thread, if any
+ * @return nothing
+ */
+void compiled_stil::compile(bool pipelined) {
+	if(compiled) {
+		return;
+	}
+	if(pipelined) {
+		read_tokens_pipelined();
+	}else{
+		read_tokens();
+	}
+	inputfile.close();
+	compiled=true;
+}
+
+
+// Has the input file been compiled?
+bool compiled_stil::is_compiled() const {
+	return compiled;
+}
+
+
+// Name of the input file
+string compiled_stil::get_filename() const {
+	return in_file;
+}
+
+
+// List of the tokens of the input file
+const str_list &compiled_stil::get_tokens() const {
+	return tokens;
+}
+
+
+/**
+ * Function to read the tokens of the input file into the list of tokens
+ * @return nothing
+ * O(n) computational time complexity, for n characters in the input file
+ */
+void compiled_stil::read_tokens() {
+	MEM_SCOPE(MEM_TOKENS);
+	// Line of the input file; it is not truncated, whatever its length
+	string line;
+	// While there are any more lines in the text file to be read
+	while(getline(inputfile, line)) {
+		tokenize_line(line, tokens);
+	}
+}
+
+
+
+/**
+ * Function to read the tokens of the input file on the lexer thread, which
+ * hands them to this thread in batches, through a bounded ring
+ * The statements are only executed once the whole input file is lexed,
+ * since the definitions that they refer to are searched for in the whole
+ * list of tokens
+ * @throws the exception that was thrown by the lexer thread, if any
+ * @return nothing
+ */
+void compiled_stil::read_tokens_pipelined() {
+	MEM_SCOPE(MEM_TOKENS);
+	spsc_ring<str_list> batches(LEXER_RING_SIZE);
+	exception_ptr failure;
+	thread lexer([this, &batches, &failure] {
+		MEM_SCOPE(MEM_TOKENS);
+		trace_events::set_thread_name("lexer");
+		trace_events::scope event("lex");
+		try {
+			str_list batch;
+			string line;
+			while(getline(inputfile, line)) {
+				tokenize_line(line, batch);
+				if(batch.size() >= (size_t)LEXER_BATCH) {
+					batches.push(batch);
+					batch.clear();
+				}
+			}
+			if(!batch.empty()) {
+				batches.push(batch);
+			}
+		}catch(...) {
+			failure=current_exception();
+		}
+		batches.close();
+	});
+
+	// Append each batch to the list of tokens, without copying its tokens
+	str_list batch;
+	while(batches.pop(batch)) {
+		tokens.splice(tokens.end(), batch);
+	}
+	lexer.join();
+	if(failure) {
+		rethrow_exception(failure);
+	}
+}
+
+
+
+/**
+ * Function to split a line of the input file into tokens, which are
+ * delimited by spaces
+ * @param line is the line
+ * @param tokens is appended the tokens of the line; empty tokens are not
+ * @return nothing
+ */
+void compiled_stil::tokenize_line(const string &line, str_list &tokens) {
+	size_t first=line.find_first_not_of(' ');
+	while(first != string::npos) {
+		size_t last=line.find(' ', first);
+		if(last == string::npos) {
+			tokens.push_back(line.substr(first));
+			return;
+		}
+		tokens.push_back(line.substr(first, last-first));
+		first=line.find_first_not_of(' ', last);
+	}
+}
@@ -0,0 +1,76 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Compiled STIL file: the list of tokens of the input file
+ * It is only written whilst it is compiled; afterwards, it is read-only, so
+ * that any number of runs (file_analyzer) can execute its pattern at the
+ * same time, each on its own thread, without any lock. Every state of a run
+ * is kept in its file_analyzer.
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <list>
+
+
+#ifndef __COMPILED_STIL_H
+#define __COMPILED_STIL_H
+using namespace std;
+
+// =======================================================================
+
+// List of strings
+typedef list<string> str_list;
+// Pointer to list of strings; the tokens of a compiled file are read-only
+typedef list<string>::const_iterator str_l_p;
+
+
+// Class definition...
+class compiled_stil {
+	public:
+		// Initialize constants...
+		// Number of tokens in each batch that is handed over by the lexer
+		static const int LEXER_BATCH = 4096;
+		// Number of batches of tokens that can be in flight
+		static const int LEXER_RING_SIZE = 16;
+
+		// Default constructor; a file without any token
+		compiled_stil();
+		// Standard Constructor; opens the input file
+		compiled_stil(string input_filename);
+
+		// Define headers for functions...
+		/**
+		 * Read the tokens of the input file; on the lexer thread if
+		 * pipelined
+		 */
+		void compile(bool pipelined);
+		bool is_compiled() const;
+		string get_filename() const;
+		// List of the tokens of the input file
+		const str_list &get_tokens() const;
+		// Split a line into its tokens, which are delimited by spaces
+		static void tokenize_line(const string &line, str_list &tokens);
+
+
+	private:
+		// Declaration of instance variables...
+		// Name of input file
+		string in_file;
+		// Input stream for the input file; closed once it is compiled
+		ifstream inputfile;
+		// List of strings tokens found in the input file
+		str_list tokens;
+		bool compiled;
+
+		void read_tokens();
+		void read_tokens_pipelined();
+		// Copy constructor and assignment are not supported
+		compiled_stil(const compiled_stil &);
+		compiled_stil &operator=(const compiled_stil &);
+};
+#endif
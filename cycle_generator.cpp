@@ -0,0 +1,39 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Lazy generator of the cycles of a compiled STIL file; see
+ * cycle_generator.h
+ */
+
+// Import Header files from the C++ STL and the directory
+#include "cycle_generator.h"
+
+using namespace std;
+
+// =======================================================================
+
+/**
+ * Coroutine that yields each cycle of the pattern of a compiled file
+ * The source of the cycles lives in the frame of the coroutine; it is
+ * destroyed, and the execution of the pattern stopped, when the generator
+ * is destroyed
+ * @param stil is the compiled file; it must outlive the generator
+ * @param spec is the selection of the signals; see file_analyzer
+ * @param first is the index of the first cycle
+ * @param last is the index of the cycle after the last one; negative for
+ *	the end of the pattern
+ * @return the generator
+ */
+cycle_generator stil_cycles(const compiled_stil &stil, string spec,
+	long long first, long long last) {
+
+	cycle_source source(stil);
+	source.set_selection(spec);
+	source.set_cycle_range(first, last);
+	cycle_view view;
+	while(source.next(view)) {
+		co_yield view;
+	}
+}
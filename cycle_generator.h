@@ -0,0 +1,131 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Lazy generator of the cycles of a compiled STIL file, as a C++20
+ * coroutine; i.e.,
+ *	for(const cycle_view &v : stil_cycles(stil)) { ... }
+ * The coroutine only resumes, and the pattern is only executed up to the
+ * next cycle (see cycle_source.h), when the consumer advances; a consumer
+ * that stops early destroys the coroutine, which stops the execution.
+ */
+
+// Import Header files from the C++ STL
+#include <coroutine>
+#include <exception>
+#include <string>
+
+#include "cycle_source.h"
+
+
+#ifndef __CYCLE_GENERATOR_H
+#define __CYCLE_GENERATOR_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class cycle_generator {
+	public:
+		// State of the coroutine, which holds the view of the last cycle
+		struct promise_type {
+			const cycle_view *current;
+			exception_ptr failure;
+
+			cycle_generator get_return_object() {
+				return cycle_generator(
+					coroutine_handle<promise_type>::from_promise(*this));
+			}
+			// Nothing is executed before the first cycle is asked for
+			suspend_always initial_suspend() noexcept {
+				return suspend_always();
+			}
+			suspend_always final_suspend() noexcept {
+				return suspend_always();
+			}
+			suspend_always yield_value(const cycle_view &v) noexcept {
+				current=&v;
+				return suspend_always();
+			}
+			void return_void() {
+			}
+			void unhandled_exception() {
+				failure=current_exception();
+			}
+		};
+
+		// Iterator over the cycles; advancing it resumes the coroutine
+		class iterator {
+			public:
+				iterator(coroutine_handle<promise_type> h) : handle(h) {
+				}
+				const cycle_view &operator*() const {
+					return *(handle.promise().current);
+				}
+				iterator &operator++() {
+					handle.resume();
+					rethrow_failure(handle);
+					return *this;
+				}
+				// Is it at the end of the cycles?
+				bool operator==(default_sentinel_t) const {
+					return (!handle) || handle.done();
+				}
+
+			private:
+				coroutine_handle<promise_type> handle;
+		};
+
+		// Standard Constructor...
+		explicit cycle_generator(coroutine_handle<promise_type> h)
+			: handle(h) {
+		}
+		cycle_generator(cycle_generator &&g) noexcept : handle(g.handle) {
+			g.handle=nullptr;
+		}
+		// Destructor; destroys the coroutine, and the source of its cycles
+		~cycle_generator() {
+			if(handle) {
+				handle.destroy();
+			}
+		}
+
+		// Define headers for functions...
+		// Execute the pattern up to the first cycle
+		iterator begin() {
+			if(handle) {
+				handle.resume();
+				rethrow_failure(handle);
+			}
+			return iterator(handle);
+		}
+		default_sentinel_t end() {
+			return default_sentinel;
+		}
+
+
+	private:
+		// Declaration of instance variables...
+		coroutine_handle<promise_type> handle;
+
+		// Throw the exception that ended the coroutine, if any
+		static void rethrow_failure(coroutine_handle<promise_type> h) {
+			if(h.done() && h.promise().failure) {
+				rethrow_exception(h.promise().failure);
+			}
+		}
+		// Copy constructor and assignment are not supported
+		cycle_generator(const cycle_generator &);
+		cycle_generator &operator=(const cycle_generator &);
+};
+
+
+/**
+ * Generator of the cycles of the pattern of a compiled file, from the
+ * cycle first up to the cycle last-1 (negative for the end of the pattern),
+ * with the values of the signals in the selection spec (all if empty)
+ */
+cycle_generator stil_cycles(const compiled_stil &stil, string spec="",
+	long long first=0, long long last=-1);
+#endif
@@ -0,0 +1,154 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Source of the cycles of the pattern, on demand; see cycle_source.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #The consumer and the thread that executes the pattern never run at the
+ *	same time: each waits whilst the other holds the cycle, so that the
+ *	values of the cycle need no lock of their own
+ * #The run only reads the compiled file, which may be shared by other runs
+ */
+
+// Import Header files from the C++ STL and the directory
+#include "cycle_source.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// =======================================================================
+
+/**
+ * Standard constructor
+ * @param stil is the compiled file; it must outlive the source
+ * @throws ViolatedPrecondition exception if it has not been compiled
+ */
+cycle_source::cycle_source(const compiled_stil &stil) : run(stil, "") {
+	if(!stil.is_compiled()) {
+		throw ViolatedPrecondition("STIL file has not been compiled");
+	}
+	cycle=-1;
+	started=false;
+	requested=false;
+	ready=false;
+	finished=false;
+	stopping=false;
+	run.set_cycle_sink([this](long long c, vector<string> &v) {
+		hand_over(c, v);
+	});
+}
+
+// Destructor
+cycle_source::~cycle_source() {
+	if(started) {
+		{
+			lock_guard<mutex> lk(lock);
+			stopping=true;
+		}
+		changed.notify_all();
+		executor.join();
+	}
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+// Functions to set the options of the run; see file_analyzer
+void cycle_source::set_selection(string spec) {
+	run.set_selection(spec);
+}
+
+void cycle_source::set_cycle_range(long long first, long long last) {
+	run.set_cycle_range(first, last);
+}
+
+void cycle_source::set_measure_of_time(int ns) {
+	run.set_measure_of_time(ns);
+}
+
+
+/**
+ * Function to execute the pattern up to the end of the next cycle
+ * The thread that executes the pattern is started by the first call
+ * @param view is assigned the view over the values of the cycle; it is
+ *	valid until the next call
+ * @throws the exception that ended the execution of the pattern, if any
+ * @return true if a cycle is handed over; false at the end of the pattern
+ */
+bool cycle_source::next(cycle_view &view) {
+	unique_lock<mutex> lk(lock);
+	if(finished) {
+		return false;
+	}
+	requested=true;
+	if(!started) {
+		started=true;
+		executor=thread(&cycle_source::execute, this);
+	}else{
+		changed.notify_all();
+	}
+	changed.wait(lk, [this] {
+		return ready || finished;
+	});
+	if(!ready) {
+		if(failure) {
+			rethrow_exception(failure);
+		}
+		return false;
+	}
+	ready=false;
+	view=cycle_view(cycle, &names, &inputs, &values);
+	return true;
+}
+
+
+/**
+ * Function that runs the thread that executes the pattern, until its end,
+ * or until the execution is stopped
+ * @return nothing
+ */
+void cycle_source::execute() {
+	try {
+		run.parse_input();
+	}catch(stop_execution &) {
+		// The consumer has stopped asking for cycles
+	}catch(...) {
+		failure=current_exception();
+	}
+	{
+		lock_guard<mutex> lk(lock);
+		finished=true;
+	}
+	changed.notify_all();
+}
+
+
+/**
+ * Function to hand a cycle over to the consumer, and to wait until the
+ * next cycle is asked for; called on the thread that executes the pattern
+ * @param c is the index of the cycle
+ * @param v is the values of each selected signal in the cycle; they are
+ *	swapped with those of the previous cycle
+ * @throws stop_execution if the source is destroyed in the meantime
+ * @return nothing
+ */
+void cycle_source::hand_over(long long c, vector<string> &v) {
+	unique_lock<mutex> lk(lock);
+	if(names.empty()) {
+		run.get_selected_signals(names, inputs);
+	}
+	cycle=c;
+	values.swap(v);
+	requested=false;
+	ready=true;
+	changed.notify_all();
+	changed.wait(lk, [this] {
+		return requested || stopping;
+	});
+	if(stopping) {
+		throw stop_execution();
+	}
+}
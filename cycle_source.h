@@ -0,0 +1,134 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Source of the cycles of the pattern of a compiled STIL file, on demand
+ * The pattern is executed by a run (file_analyzer) on its own thread, which
+ * hands each cycle over to the consumer, and then waits until the next
+ * cycle is asked for; the execution never runs ahead of the consumer. If
+ * the source is destroyed before the end of the pattern, the execution is
+ * stopped where it is, and the rest of the pattern is never executed.
+ */
+
+// Import Header files from the C++ STL
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+#include "compiled_stil.h"
+#include "file_analyzer.h"
+
+
+#ifndef __CYCLE_SOURCE_H
+#define __CYCLE_SOURCE_H
+using namespace std;
+
+// =======================================================================
+
+/**
+ * View over the values of the selected signals in a cycle; it is only
+ * valid until the next cycle is asked for
+ */
+class cycle_view {
+	public:
+		// Default constructor; a view over no cycle
+		cycle_view() : cycle(-1), names(NULL), inputs(NULL), values(NULL) {
+		}
+		cycle_view(long long c, const vector<string> *n,
+			const vector<bool> *in, const vector<string> *v)
+			: cycle(c), names(n), inputs(in), values(v) {
+		}
+
+		// Index of the cycle in the pattern
+		long long get_cycle() const {
+			return cycle;
+		}
+		// Number of selected signals; the inputs, then the outputs
+		size_t get_num_signals() const {
+			return names->size();
+		}
+		const string &get_name(size_t i) const {
+			return (*names)[i];
+		}
+		bool is_input(size_t i) const {
+			return (*inputs)[i];
+		}
+		// Values of the signal "i" in this cycle, one for each quantum
+		const string &get_values(size_t i) const {
+			return (*values)[i];
+		}
+
+
+	private:
+		long long cycle;
+		const vector<string> *names;
+		const vector<bool> *inputs;
+		const vector<string> *values;
+};
+
+
+// Class definition...
+class cycle_source {
+	public:
+		// Standard Constructor; the compiled file must outlive the source
+		cycle_source(const compiled_stil &stil);
+		// Destructor; stops the execution of the pattern
+		~cycle_source();
+
+		// Define headers for functions...
+		/**
+		 * Options of the run, which are set before the first cycle is
+		 * asked for; see file_analyzer
+		 */
+		void set_selection(string spec);
+		void set_cycle_range(long long first, long long last);
+		void set_measure_of_time(int ns);
+		/**
+		 * Execute the pattern up to the end of the next cycle
+		 * @return false at the end of the pattern
+		 */
+		bool next(cycle_view &view);
+
+
+	private:
+		// Thrown through the execution of the pattern, to stop it
+		struct stop_execution {
+		};
+
+		// Declaration of instance variables...
+		file_analyzer run;
+		// Selected signals, and their values in the current cycle
+		vector<string> names;
+		vector<bool> inputs;
+		vector<string> values;
+		long long cycle;
+		// Thread that executes the pattern
+		thread executor;
+		bool started;
+		/**
+		 * Hand-over between the threads: has a cycle been asked for, has it
+		 * been handed over, has the pattern ended, and is the execution to
+		 * be stopped?
+		 */
+		mutex lock;
+		condition_variable changed;
+		bool requested;
+		bool ready;
+		bool finished;
+		bool stopping;
+		// Exception that ended the execution, if any
+		exception_ptr failure;
+
+		// Main loop of the thread that executes the pattern
+		void execute();
+		// Hand a cycle over, and wait until the next one is asked for
+		void hand_over(long long c, vector<string> &v);
+		// Copy constructor and assignment are not supported
+		cycle_source(const cycle_source &);
+		cycle_source &operator=(const cycle_source &);
+};
+#endif
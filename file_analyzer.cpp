@@ -29,7 +29,14 @@
 #include <iomanip>
 #include <climits>
 #include <ctype.h>
+#include <fnmatch.h>
 #include "file_analyzer.h"
+#include "pattern_writer.h"
+#include "vcd_writer.h"
+#include "vector_writer.h"
+#include "parallel_table_writer.h"
+#include "trace.h"
+#include "mem_stats.h"
 #include "ViolatedAssertion.h"
 #include "ViolatedPostcondition.h"
 #include "ViolatedPrecondition.h"
@@ -99,39 +106,141 @@ likewise for output pin
 // ==========================================================================
 
 // Default constructor
-file_analyzer::file_analyzer() {
+file_analyzer::file_analyzer() : own_compiled(new compiled_stil()),
+	compiled(own_compiled), list_tokens(own_compiled->get_tokens()) {
+
 	in_file=INVALID;
 	out_file=INVALID;
+	measure_of_time=MEASURE_OF_TIME;
 	period_t=INVALID_CHAR_INDEX;
+	streaming=false;
+	num_cycles=0;
+	output_format=FORMAT_TABLE;
+	record_index=false;
+	index_stride=DEFAULT_INDEX_STRIDE;
+	write_table_index=false;
+	num_threads=1;
+	pool=NULL;
+	deferring=false;
+	stats=NULL;
+	in_shift=false;
+	first_cycle=0;
+	last_cycle=-1;
+	slice_done=false;
+	pipelined=false;
+	pipeline=NULL;
 }
 
-// Standard constructor
-file_analyzer::file_analyzer(string input_filename, string output_filename) {	
+/**
+ * Standard constructor
+ * The input file is compiled by parse_input(), and only used by this run
+ * @param input_filename is the name of the STIL file
+ * @param output_filename is the name of the output file
+ * @throws ViolatedPrecondition exception if the input file does not exist
+ */
+file_analyzer::file_analyzer(string input_filename, string output_filename)
+	: own_compiled(new compiled_stil(input_filename)), compiled(own_compiled),
+	list_tokens(own_compiled->get_tokens()) {
+
 	in_file=input_filename;
 	out_file=output_filename;
+	measure_of_time=MEASURE_OF_TIME;
+	period_t=INVALID_CHAR_INDEX;
+	streaming=false;
+	num_cycles=0;
+	output_format=FORMAT_TABLE;
+	record_index=false;
+	index_stride=DEFAULT_INDEX_STRIDE;
+	write_table_index=false;
+	num_threads=1;
+	pool=NULL;
+	deferring=false;
+	stats=NULL;
+	in_shift=false;
+	first_cycle=0;
+	last_cycle=-1;
+	slice_done=false;
+	pipelined=false;
+	pipeline=NULL;
 	/**
-	 * Convert input filename to string in C so that the file I/O function
-	 * in the C++ library can be utilised for opening the input file
+	 * Open the output file through the output buffer, which is only
+	 * flushed when it is full, or at explicit flush points
 	 */
-	inputfile.open(in_file.c_str());
-	// Assertion to check if the input file exist
-	if(inputfile == NULL) {
-		cerr << "Input file, with the filename " << in_file
+	outputfile.open(out_file);
+	// Assertion to check if the output file was opened properly
+	if(!outputfile.is_open()) {
+		cout << "Output file, with the filename " << out_file
 			<< ", does not exist!" << endl;
-		throw ViolatedPrecondition("Invalid file name");
 	}
-	/**
-	 * Convert output filename to string in C so that the file I/O function
-	 * in the C++ library can be utilised for opening the output file
-	 */
-	outputfile.open(out_file.c_str());
+}
+
+/**
+ * Constructor of a run of a compiled file
+ * The run only reads the compiled file; any number of runs, each with its
+ * own output file, slice and selection of signals, may share it at the
+ * same time, on different threads. It must outlive the run.
+ * @param stil is the compiled file
+ * @param output_filename is the name of the output file; empty if the
+ *	cycles are only handed to a cycle sink, see set_cycle_sink()
+ */
+file_analyzer::file_analyzer(const compiled_stil &stil, string output_filename)
+	: own_compiled(NULL), compiled(&stil), list_tokens(stil.get_tokens()) {
+
+	in_file=stil.get_filename();
+	out_file=output_filename;
+	measure_of_time=MEASURE_OF_TIME;
+	period_t=INVALID_CHAR_INDEX;
+	streaming=false;
+	num_cycles=0;
+	output_format=FORMAT_TABLE;
+	record_index=false;
+	index_stride=DEFAULT_INDEX_STRIDE;
+	write_table_index=false;
+	num_threads=1;
+	pool=NULL;
+	deferring=false;
+	stats=NULL;
+	in_shift=false;
+	first_cycle=0;
+	last_cycle=-1;
+	slice_done=false;
+	pipelined=false;
+	pipeline=NULL;
+	if(out_file.empty()) {
+		return;
+	}
+	outputfile.open(out_file);
 	// Assertion to check if the output file was opened properly
-	if(outputfile == NULL) {
+	if(!outputfile.is_open()) {
 		cout << "Output file, with the filename " << out_file
 			<< ", does not exist!" << endl;
 	}
 }
 
+// Destructor
+file_analyzer::~file_analyzer() {
+	// The stages of the pipeline use the signals and the output file
+	if(pipeline != NULL) {
+		delete pipeline;
+	}
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		delete (*p);
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		delete (*p);
+		p++;
+	}
+	if(pool != NULL) {
+		delete pool;
+	}
+	if(own_compiled != NULL) {
+		delete own_compiled;
+	}
+}
+
 // =======================================================================
 
 // Implement function definitions...
@@ -143,57 +252,15 @@ file_analyzer::file_analyzer(string input_filename, string output_filename) {
  * @param o_file is the output file containing the test patterns
  */
 void file_analyzer::parse_input() {
-	// Parse the input file...
-	
-	/**
-	 * Array of characters to contain data obtained from the first
-	 * n characters of each line
-	 */
-	char temp_buffer[MAX_NUM_OF_CHAR_PER_LINE];
-	// Store the currently processed token
-	char *cur_token;
-	/**
-	 * C++ string representation of the search key to utilize functions from
-	 * the C++ STL
-	 */
-	string key;
-
-	// Container for tokens in currently enumerated line of the input file
-	string cstr = "";
-	// While there are any more lines in the text file to be read
-	while(!inputfile.eof()) {
-		// Read the line's first 1000 characters
-		inputfile.getline(temp_buffer,MAX_NUM_OF_CHAR_PER_LINE);
-		// Convert the C string into a C++ string
-		cstr = temp_buffer;
-		// If this string is not empty
-		if(!cstr.empty()) {
-			// Set whitespace as teh delimiter for tokens
-			cur_token = strtok(temp_buffer, " ");
-			
-			
-			// Acquire the first token...
-			key = cur_token;
-			// Insert the token into a list of string tokens
-			list_tokens.push_back(key);
-
-			cur_token = strtok(NULL, " ");
-			while (cur_token != NULL) {
-				// Get the current token as an integer from the char array				
-				// Move to the next available token
-				key = cur_token;
-				// Insert this token into a list of string tokens
-				list_tokens.push_back(key);
-				
-				// Attempt to get the next string token
-				cur_token = strtok(NULL, " ");
-				/**
-				 * Do NOT do any processing after this line since it can be null
-				 */
-			}
-		}
+	// Parse the input file into a list of string tokens, unless it is shared
+	if(own_compiled != NULL) {
+		run_stats::scope guard(stats, run_stats::PHASE_READ);
+		own_compiled->compile(pipelined);
+	}
+	if(!compiled->is_compiled()) {
+		throw ViolatedPrecondition("STIL file has not been compiled");
 	}
-cout << "Size of list is:::" << list_tokens.size() << endl;
+TRACE(TRACE_TOKENS, TRACE_INFO, "Size of list is:::" << list_tokens.size());
 /*
 cout<<"========================================================="<<endl;
 str_l_p t_p=list_tokens.begin();
@@ -218,25 +285,112 @@ cout<<"========================================================="<<endl;
 	 * Print the header of the output file to indicate the day, month, date,
 	 * and year in which the test patterns were created in the STIL file
 	 */
-	process_header();
+	{
+		run_stats::scope guard(stats, run_stats::PHASE_HEADER);
+		process_header();
+	}
 	
 	// Acquire the signals of the circuit/system under test
-	process_sig_grps();
-cout<<"^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^"<<endl;
-cout<<"^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^"<<endl;
-cout<<"process pattern block"<<endl;
-cout<<"^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^"<<endl;
-cout<<"^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^"<<endl;
+	{
+		run_stats::scope guard(stats, run_stats::PHASE_SIGNALS);
+		process_sig_grps();
+	}
+	// Only the selected signals are expanded, stored and written
+	apply_selection();
+	// The cycles before the slice only update the state of the signals
+	if(first_cycle > 0) {
+		set_fast_forward(true);
+	}
+	// The cycles of a sink are only taken from the signals, one at a time
+	if(cycle_sink && (streaming || pipelined)) {
+		throw ViolatedPrecondition("Cycle sink only takes a single cycle");
+	}
+	// The signals are expanded in parallel, a batch of cycles at a time
+	if((num_threads > 1) && (!streaming) && (!pipelined)
+		&& (!cycle_sink)) {
+
+		set_deferred(true);
+	}
+	// Are the cycles written to the output file as they are executed?
+	if(streaming) {
+		begin_cycle_output();
+	}
+TRACE(TRACE_PATTERN, TRACE_INFO, "^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^");
+TRACE(TRACE_PATTERN, TRACE_INFO, "^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^");
+TRACE(TRACE_PATTERN, TRACE_INFO, "process pattern block");
+TRACE(TRACE_PATTERN, TRACE_INFO, "^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^");
+TRACE(TRACE_PATTERN, TRACE_INFO, "^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^");
+	/**
+	 * The binary pattern format holds an index of its cycles, and so does
+	 * the sidecar index of the table; a VCD file is timed, and the rows of
+	 * the vector-major table are aligned, by the values of each signal in
+	 * every cycle
+	 */
+	record_index=(output_format == FORMAT_BINARY)
+		|| (output_format == FORMAT_VCD) || (output_format == FORMAT_VECTOR)
+		|| (write_table_index && (output_format == FORMAT_TABLE) && (!streaming));
+	if((output_format == FORMAT_VCD) || (output_format == FORMAT_VECTOR)) {
+		index_stride=1;
+	}
+	// The signals are expanded, and the rows written, by the pipeline
+	if(pipelined) {
+		start_pipeline();
+	}
+	if(record_index && (first_cycle == 0)) {
+		// The first checkpoint is the start of the pattern
+		record_checkpoint();
+	}
 	/**
 	 * Process the pattern block next, since this program is supposed to
 	 * generate test patterns
 	 */
-	process_pattern_blk();
-cout<<"+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++"<<endl;
-cout<<"Dump the output to an output file..."<<endl;
-	dump_output();
-	// Close the input and output file streams...
-	close_io_streams();
+	{
+		run_stats::scope guard(stats, run_stats::PHASE_PATTERN);
+		process_pattern_blk();
+		// Expand the last batch of cycles
+		if(deferring) {
+			set_deferred(false);
+		}
+		if(pipeline != NULL) {
+			stop_pipeline();
+		}
+	}
+	// Has the pattern ended before the slice?
+	if(num_cycles < first_cycle) {
+		cerr << "Pattern has " << num_cycles << " cycles; the slice from cycle "
+			<< first_cycle << " is empty" << endl;
+		set_fast_forward(false);
+		if(record_index) {
+			record_checkpoint();
+		}
+	}
+TRACE(TRACE_OUTPUT, TRACE_INFO, "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++");
+TRACE(TRACE_OUTPUT, TRACE_INFO, "Dump the output to an output file...");
+	// The cycles have already been written, if they are streamed
+	{
+		run_stats::scope guard(stats, run_stats::PHASE_OUTPUT);
+		if(cycle_sink) {
+			// The cycles have been handed to the sink; nothing is written
+		}else if(output_format == FORMAT_BINARY) {
+			dump_binary_output();
+		}else if(output_format == FORMAT_VCD) {
+			dump_vcd_output();
+		}else if(output_format == FORMAT_VECTOR) {
+			dump_vector_output();
+		}else if(!streaming) {
+			dump_output();
+		}
+		if(stats != NULL) {
+			count_stats();
+		}
+		// Close the input and output file streams...
+		close_io_streams();
+	}
+	// Stop the worker threads
+	if(pool != NULL) {
+		delete pool;
+		pool=NULL;
+	}
 }
 
 
@@ -249,9 +403,863 @@ cout<<"Dump the output to an output file..."<<endl;
  * O(1); COMPLETED
  */
 void file_analyzer::print_output_ln(string current_ln) {
-	// Left align the data in the output file
-	outputfile.setf(ios::left);
-	outputfile << current_ln << endl;
+	// Append the line to the output buffer, without flushing it
+	outputfile.write(current_ln);
+	outputfile.put('\n');
+}
+
+
+
+/**
+ * Function to select the streaming cycle-major output
+ * Instead of a line for each signal that is written after the pattern block
+ * has been processed, a row holding all signals is written for each cycle
+ * as soon as the cycle has been executed. The expanded values of a signal
+ * are then only kept for a single cycle.
+ * @param enable is true if the cycles are to be streamed
+ * @return nothing
+ */
+void file_analyzer::set_streaming(bool enable) {
+	streaming=enable;
+}
+
+
+
+/**
+ * Function to write the names of the columns of the cycle-major output
+ * The first column is the index of the cycle, followed by a column for each
+ * input signal, and then for each output signal
+ * @return nothing
+ */
+void file_analyzer::begin_cycle_output() {
+	print_output_ln(">>>Cycle-major values of the input and output signals");
+	outputfile.write("cycle", 5);
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		if((*p)->is_selected()) {
+			outputfile.put('\t');
+			outputfile.write((*p)->get_name());
+		}
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		if((*p)->is_selected()) {
+			outputfile.put('\t');
+			outputfile.write((*p)->get_name());
+		}
+		p++;
+	}
+	outputfile.put('\n');
+}
+
+
+
+/**
+ * Function to complete a cycle of the pattern, after a vector (V) has been
+ * executed in the pattern block, a macro, or a Shift block of a procedure
+ * When streaming, the values expanded in this cycle are written as a row,
+ * and discarded
+ * @return nothing
+ */
+void file_analyzer::end_of_cycle() {
+	MEM_SCOPE(MEM_OUTPUT);
+	if(pipeline != NULL) {
+		// The row of this cycle is formatted and written by the pipeline
+		pipeline->end_of_cycle(num_cycles,
+			streaming && (num_cycles >= first_cycle));
+	}else if(cycle_sink && (num_cycles >= first_cycle)) {
+		// Take the values of each selected signal in this cycle
+		size_t i=0;
+		for(int k=0; k<2; k++) {
+			sig_list &sl=(k == 0) ? list_of_ip_signals : list_of_op_signals;
+			sig_l_p p = sl.begin();
+			while(p != sl.end()) {
+				if((*p)->is_selected()) {
+					if(i == cycle_values.size()) {
+						cycle_values.push_back("");
+					}
+					cycle_values[i].clear();
+					(*p)->take_values(cycle_values[i]);
+					i++;
+				}
+				p++;
+			}
+		}
+		cycle_sink(num_cycles, cycle_values);
+	}else if(streaming && (num_cycles >= first_cycle)) {
+		// Index of this cycle, in 64 bits...
+		char index[24];
+		int n=snprintf(index, sizeof(index), "%lld", num_cycles);
+		outputfile.write(index, n);
+		// ... followed by the values of each signal in this cycle
+		sig_l_p p = list_of_ip_signals.begin();
+		while(p != list_of_ip_signals.end()) {
+			if((*p)->is_selected()) {
+				outputfile.put('\t');
+				(*p)->drain_values(outputfile);
+			}
+			p++;
+		}
+		p = list_of_op_signals.begin();
+		while(p != list_of_op_signals.end()) {
+			if((*p)->is_selected()) {
+				outputfile.put('\t');
+				(*p)->drain_values(outputfile);
+			}
+			p++;
+		}
+		outputfile.put('\n');
+	}
+
+	num_cycles++;
+	// Expand the batch of cycles that has been executed
+	if((num_cycles%EXPANSION_BATCH) == 0) {
+		expand_signals();
+	}
+	if(num_cycles == first_cycle) {
+		// The slice starts with the next cycle
+		set_fast_forward(false);
+		if(record_index) {
+			record_checkpoint();
+		}
+	}else if(record_index && (num_cycles > first_cycle)
+		&& (((num_cycles-first_cycle)%index_stride) == 0)) {
+
+		// This is the start of a checkpoint of the cycle index
+		record_checkpoint();
+	}
+	// Is this the last cycle of the slice?
+	if((last_cycle >= 0) && (num_cycles >= last_cycle)) {
+		slice_done=true;
+	}
+}
+
+
+
+/**
+ * Function to write only a slice of the cycles of the pattern
+ * The cycles before the slice are executed at the level of the state of
+ * the signals (conditions, last patterns, WaveformTables and the count of
+ * cycles): their values are neither stored nor written. The execution of
+ * the pattern stops after the last cycle of the slice.
+ * @param first is the index of the first cycle of the slice
+ * @param last is the index of the cycle after the slice; negative for the
+ *	end of the pattern
+ * @throws ViolatedPrecondition exception if the slice is empty or invalid
+ * @return nothing
+ */
+void file_analyzer::set_cycle_range(long long first, long long last) {
+	if((first < 0) || ((last >= 0) && (last <= first))) {
+		throw ViolatedPrecondition("Slice of cycles is invalid");
+	}
+	first_cycle=first;
+	last_cycle=last;
+}
+
+
+
+/**
+ * Function to start or stop fast-forwarding all signals
+ * @param f is true if the values of the signals are not to be stored
+ * @return nothing
+ */
+void file_analyzer::set_fast_forward(bool f) {
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		(*p)->set_fast_forward(f);
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		(*p)->set_fast_forward(f);
+		p++;
+	}
+}
+
+
+
+// Number of cycles in the slice that have been executed
+long long file_analyzer::num_slice_cycles() {
+	return (num_cycles > first_cycle) ? (num_cycles-first_cycle) : 0;
+}
+
+
+
+/**
+ * Function to select the format of the output file
+ * @param format is FORMAT_TABLE for the tabular text file, or
+ *	FORMAT_BINARY for the compact binary pattern format, FORMAT_VCD for
+ *	a Value Change Dump file, or FORMAT_VECTOR for the vector-major table
+ * @throws ViolatedPrecondition exception if the format is invalid
+ * @return nothing
+ */
+void file_analyzer::set_output_format(int format) {
+	if((format != FORMAT_TABLE) && (format != FORMAT_BINARY)
+		&& (format != FORMAT_VCD) && (format != FORMAT_VECTOR)) {
+
+		throw ViolatedPrecondition("Format of output file is invalid");
+	}
+	output_format=format;
+}
+
+
+
+/**
+ * Function to set the number of cycles between two checkpoints of the
+ * cycle index
+ * @param stride is the number of cycles; 1 indexes every cycle
+ * @throws ViolatedPrecondition exception if the stride is not positive
+ * @return nothing
+ */
+void file_analyzer::set_index_stride(int stride) {
+	if(stride < 1) {
+		throw ViolatedPrecondition("Stride of cycle index must be positive");
+	}
+	index_stride=stride;
+}
+
+
+
+/**
+ * Function to record a checkpoint of the cycle index
+ * The number of values of each signal is the offset of the first value of
+ * the cycle that starts now
+ * @return nothing
+ */
+void file_analyzer::record_checkpoint() {
+	// The pipeline counts the values, once it has expanded the cycles so far
+	if(pipeline != NULL) {
+		pipeline->checkpoint();
+		return;
+	}
+	// The values of the cycles so far are counted
+	expand_signals();
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		if((*p)->is_selected()) {
+			cycle_index.push_back((*p)->get_num_samples());
+		}
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		if((*p)->is_selected()) {
+			cycle_index.push_back((*p)->get_num_samples());
+		}
+		p++;
+	}
+}
+
+
+
+/**
+ * Function to record a WaveformTable, when it is compiled for the first time
+ * @param name is the name of the WaveformTable
+ * @param period is its period in picoseconds
+ * @return nothing
+ */
+void file_analyzer::record_wft(string name, int64_t period) {
+	for(int i=0; i<wft_names.size(); i++) {
+		if(wft_names[i] == name) {
+			return;
+		}
+	}
+	wft_names.push_back(name);
+	wft_periods.push_back(period);
+}
+
+
+
+/**
+ * Function to write the signals to the output file in the compact binary
+ * pattern format; see pattern_format.h
+ * @return nothing
+ */
+void file_analyzer::dump_binary_output() {
+	MEM_SCOPE(MEM_OUTPUT);
+	pattern_writer pw(outputfile);
+	pw.set_quantum(measure_of_time*signalZ::PS_PER_UNIT_OF_TIME);
+	pw.set_date(test_date);
+	for(int i=0; i<wft_names.size(); i++) {
+		pw.add_wft(wft_names[i], wft_periods[i]);
+	}
+
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		if((*p)->is_selected()) {
+			pw.add_signal(*p, PATTERN_INPUT);
+		}
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		if((*p)->is_selected()) {
+			pw.add_signal(*p, PATTERN_OUTPUT);
+		}
+		p++;
+	}
+
+	pw.set_cycle_index(num_slice_cycles(), index_stride, cycle_index);
+	pw.write();
+}
+
+
+
+/**
+ * Function to write the signals to the output file as a Value Change Dump
+ * (VCD) file; only the changes in the values of the signals are written
+ * Each cycle lasts as many quanta of time as the signal with the most values
+ * in it, as in the rows of --stream; the cycle index, of every cycle, holds
+ * the number of values of each signal at its start
+ * @return nothing
+ */
+void file_analyzer::dump_vcd_output() {
+	MEM_SCOPE(MEM_OUTPUT);
+	vcd_writer vw(outputfile);
+	vw.set_quantum(measure_of_time*signalZ::PS_PER_UNIT_OF_TIME);
+	vw.set_date(test_date);
+
+	// Selected signals: the columns of the cycle index
+	vector<signalZ *> columns;
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		if((*p)->is_selected()) {
+			columns.push_back(*p);
+		}
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		if((*p)->is_selected()) {
+			columns.push_back(*p);
+		}
+		p++;
+	}
+
+	// Start of each cycle, and the end of the last one, in quanta of time
+	int n=columns.size();
+	uint64_t checkpoints=(n > 0) ? (cycle_index.size()/n) : 0;
+	vector<uint64_t> starts(1, 0);
+	for(uint64_t c=1; c<checkpoints; c++) {
+		uint64_t longest=0;
+		for(int i=0; i<n; i++) {
+			longest=max(longest, cycle_index[c*n+i]-cycle_index[(c-1)*n+i]);
+		}
+		starts.push_back(starts.back()+longest);
+	}
+
+	for(int i=0; i<n; i++) {
+		vw.add_signal(columns[i]->get_name(), new string_timeline(
+			columns[i]->get_sig_values(), cycle_index, n, i, starts));
+	}
+	vw.write();
+}
+
+
+
+/**
+ * Function to select whether the sidecar index of the table is written
+ * The index holds the offset of each row of the table, and of its first
+ * value, and the first value of every index_stride cycles in each row; see
+ * table_index.h. It is written to the name of the output file, with the
+ * suffix ".idx".
+ * @param enable is true if the index is to be written
+ * @return nothing
+ */
+void file_analyzer::set_table_index(bool enable) {
+	write_table_index=enable;
+}
+
+
+
+/**
+ * Function to add a row of the table to its index, after it has been written
+ * @param ti is the index of the table
+ * @param s is the signal of the row
+ * @param row_offset is the offset of the row in the output file
+ * @return nothing
+ */
+void file_analyzer::add_index_row(table_index &ti, signalZ *s, uint64_t row_offset) {
+	uint64_t num_values=s->get_sig_values().size();
+	// The values are followed by a newline
+	uint64_t value_offset=outputfile.bytes_written()-num_values-1;
+	ti.add_row(s->get_name(), row_offset, value_offset, num_values);
+}
+
+
+
+/**
+ * Function to set the selection of signals
+ * @param spec is a comma-separated list of names of signals, names of
+ *	groups of signals (piPins, poPins or allPins), or glob patterns of names
+ *	of signals (e.g., "scan*"); an empty list selects all signals
+ * @return nothing
+ */
+void file_analyzer::set_selection(string spec) {
+	selection.clear();
+	size_t start=0;
+	while(start <= spec.size()) {
+		size_t end=spec.find(',', start);
+		if(end == string::npos) {
+			end=spec.size();
+		}
+		if(end > start) {
+			selection.push_back(spec.substr(start, end-start));
+		}
+		start=end+1;
+	}
+}
+
+
+
+/**
+ * Function to determine whether a signal is selected by an entry of the
+ * selection of signals
+ * @param entry is the name of a signal or group, or a glob pattern
+ * @param s is the signal
+ * @param is_input is true if s is an input signal
+ * @return true if the entry selects the signal; else, return false
+ */
+bool file_analyzer::selects(string entry, signalZ *s, bool is_input) {
+	if(entry == ALLPINS) {
+		return true;
+	}else if(entry == PIPINS) {
+		return is_input;
+	}else if(entry == POPINS) {
+		return !is_input;
+	}
+	return (fnmatch(entry.c_str(), s->get_name().c_str(), 0) == 0);
+}
+
+
+
+/**
+ * Function to apply the selection of signals, once the signals are known
+ * Signals that are not selected keep track of their state only; their
+ * waveforms are not expanded into values, and they are not written
+ * @return nothing
+ */
+void file_analyzer::apply_selection() {
+	if(selection.empty()) {
+		return;
+	}
+
+	// Number of signals that each entry selects
+	vector<int> num_selected(selection.size(), 0);
+	for(int list=0; list<2; list++) {
+		sig_list &signals=(list == 0) ? list_of_ip_signals : list_of_op_signals;
+		sig_l_p p = signals.begin();
+		while(p != signals.end()) {
+			bool sel=false;
+			for(size_t i=0; i<selection.size(); i++) {
+				if(selects(selection[i], *p, (list == 0))) {
+					num_selected[i]++;
+					sel=true;
+				}
+			}
+			(*p)->set_selected(sel);
+			p++;
+		}
+	}
+
+	for(size_t i=0; i<selection.size(); i++) {
+		if(num_selected[i] == 0) {
+			cerr << "Selection " << selection[i] << " matches no signal" << endl;
+		}
+	}
+}
+
+
+
+/**
+ * Function to set the number of threads that expand the signals and write
+ * the output file
+ * With more than one thread, the signals are expanded in parallel, a batch
+ * of cycles at a time, and the rows of the table are formatted in
+ * parallel; the output file is the same
+ * @param n is the number of threads
+ * @throws ViolatedPrecondition exception if n is not positive
+ * @return nothing
+ */
+void file_analyzer::set_num_threads(int n) {
+	if(n < 1) {
+		throw ViolatedPrecondition("Number of threads must be positive");
+	}
+	num_threads=n;
+}
+
+
+
+// Pool of num_threads threads, which is created when it is first used
+thread_pool &file_analyzer::get_pool() {
+	if(pool == NULL) {
+		pool=new thread_pool(num_threads);
+	}
+	return *pool;
+}
+
+
+
+/**
+ * Function to defer the expansion of all signals, or to end the deferral
+ * Whilst deferred, the waveform characters of the vectors are queued in
+ * each signal, and the queues are expanded in parallel by expand_signals()
+ * @param d is true if the expansion is deferred
+ * @return nothing
+ */
+void file_analyzer::set_deferred(bool d) {
+	if(!d) {
+		expand_signals();
+	}
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		(*p)->set_deferred(d);
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		(*p)->set_deferred(d);
+		p++;
+	}
+	deferring=d;
+}
+
+
+
+/**
+ * Function to expand the queued values of all signals on the thread pool
+ * Each worker expands a contiguous range of signals, so that no two workers
+ * write the same signal; the ranges hold about the same number of queued
+ * waveform characters.
+ * @return nothing
+ * O(n) computational time complexity, for n values, over num_threads threads
+ */
+void file_analyzer::expand_signals() {
+	if(!deferring) {
+		return;
+	}
+	vector<signalZ *> sigs;
+	uint64_t total=0;
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		sigs.push_back(*p);
+		total=total+(*p)->num_pending();
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		sigs.push_back(*p);
+		total=total+(*p)->num_pending();
+		p++;
+	}
+	if(total == 0) {
+		return;
+	}
+
+	thread_pool &threads=get_pool();
+	int n=threads.get_num_threads();
+	size_t first=0;
+	uint64_t assigned=0;
+	for(int w=0; (w < n) && (first < sigs.size()); w++) {
+		// Range of signals of this worker; the last worker takes the rest
+		size_t last=first;
+		uint64_t target=(total*(w+1))/n;
+		while((last < sigs.size()) && ((assigned < target) || (last == first))) {
+			assigned=assigned+sigs[last]->num_pending();
+			last++;
+		}
+		if(w == (n-1)) {
+			last=sigs.size();
+		}
+		threads.submit([&sigs, first, last] {
+			for(size_t i=first; i<last; i++) {
+				sigs[i]->expand_pending();
+			}
+		});
+		first=last;
+	}
+	threads.wait();
+}
+
+
+
+/**
+ * Function to run the lexing, the expansion of the signals and the output
+ * as stages of a pipeline, each on its own thread, apart from the execution
+ * of the statements of the pattern
+ * @param enable is true if the stages are pipelined
+ * @return nothing
+ */
+void file_analyzer::set_pipelined(bool enable) {
+	pipelined=enable;
+}
+
+
+
+/**
+ * Function to start the expansion and the output stages of the pipeline
+ * The signals queue the waveform characters of their vectors, which are
+ * handed to the pipeline at the end of each cycle
+ * @return nothing
+ */
+void file_analyzer::start_pipeline() {
+	pipeline=new pattern_pipeline(outputfile);
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		(*p)->set_deferred(true);
+		(*p)->set_pipeline(pipeline);
+		pipeline->add_signal(*p);
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		(*p)->set_deferred(true);
+		(*p)->set_pipeline(pipeline);
+		pipeline->add_signal(*p);
+		p++;
+	}
+	pipeline->start(streaming, &cycle_index);
+}
+
+
+
+/**
+ * Function to process the cycles that remain in the pipeline, and to stop
+ * its stages; the signals are expanded on this thread again
+ * @throws the first exception that was thrown by a stage
+ * @return nothing
+ */
+void file_analyzer::stop_pipeline() {
+	pipeline->finish();
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		(*p)->set_pipeline(NULL);
+		(*p)->set_deferred(false);
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		(*p)->set_pipeline(NULL);
+		(*p)->set_deferred(false);
+		p++;
+	}
+	delete pipeline;
+	pipeline=NULL;
+}
+
+
+
+/**
+ * Function to hand each cycle of the slice to a function, instead of
+ * writing the output file
+ * The function is called once each cycle of the slice has been executed,
+ * with the index of the cycle and the values of each selected signal (the
+ * input signals, then the output signals) in that cycle. The values are
+ * only kept for that cycle. It may throw, to stop the execution of the
+ * pattern; parse_input() then throws the exception.
+ * @param sink is the function; an empty function for none
+ * @return nothing
+ */
+void file_analyzer::set_cycle_sink(
+	function<void(long long, vector<string> &)> sink) {
+
+	cycle_sink=sink;
+}
+
+
+/**
+ * Function to list the selected signals, in the order of the values that
+ * are handed to the cycle sink; once the signals have been processed
+ * @param names is assigned the names of the signals
+ * @param inputs is assigned true for each input signal
+ * @return nothing
+ */
+void file_analyzer::get_selected_signals(vector<string> &names,
+	vector<bool> &inputs) {
+
+	names.clear();
+	inputs.clear();
+	for(int k=0; k<2; k++) {
+		sig_list &sl=(k == 0) ? list_of_ip_signals : list_of_op_signals;
+		sig_l_p p = sl.begin();
+		while(p != sl.end()) {
+			if((*p)->is_selected()) {
+				names.push_back((*p)->get_name());
+				inputs.push_back(k == 0);
+			}
+			p++;
+		}
+	}
+}
+
+
+/**
+ * Function to list the WaveformTables that have been compiled by this run
+ * @param names is assigned their names
+ * @param periods is assigned their periods, in picoseconds
+ * @return nothing
+ */
+void file_analyzer::get_wfts(vector<string> &names, vector<int64_t> &periods) {
+	names=wft_names;
+	periods=wft_periods;
+}
+
+
+/**
+ * Function to measure the phases of this run, and count its tokens, cycles,
+ * values and bytes, into statistics
+ * @param s is the statistics; NULL if they are not measured
+ * @return nothing
+ */
+void file_analyzer::set_stats(run_stats *s) {
+	stats=s;
+}
+
+
+/**
+ * Function to count the tokens, cycles and values of the selected signals,
+ * and the bytes of the output file, into the statistics
+ * @return nothing
+ */
+void file_analyzer::count_stats() {
+	stats->set_tokens(list_tokens.size());
+	stats->set_cycles(num_cycles);
+	uint64_t samples=0;
+	for(int k=0; k<2; k++) {
+		sig_list &sl=(k == 0) ? list_of_ip_signals : list_of_op_signals;
+		sig_l_p p = sl.begin();
+		while(p != sl.end()) {
+			if((*p)->is_selected()) {
+				samples=samples+(*p)->get_num_samples();
+			}
+			p++;
+		}
+	}
+	stats->set_samples(samples);
+	stats->set_bytes(outputfile.bytes_written());
+}
+
+
+/**
+ * Function to set the quantization unit of time of this run: each value of
+ * a signal lasts for this amount of time
+ * @param ns is the unit of time in nanoseconds (UNIT_OF_TIME)
+ * @throws ViolatedPrecondition exception if it is not positive
+ * @return nothing
+ */
+void file_analyzer::set_measure_of_time(int ns) {
+	if(ns <= 0) {
+		throw ViolatedPrecondition("Quantum of time must be positive");
+	}
+	measure_of_time=ns;
+}
+
+
+// Quantization unit of time of this run, in nanoseconds
+int file_analyzer::get_measure_of_time() {
+	return measure_of_time;
+}
+
+
+
+/**
+ * Function to output the signal names and their values into the output
+ * file, formatting the rows on a pool of num_threads threads
+ * @return nothing
+ */
+void file_analyzer::dump_output_parallel() {
+	MEM_SCOPE(MEM_OUTPUT);
+	parallel_table_writer ptw(outputfile, get_pool());
+	// Rows of the table, in the order of its lines
+	vector<signalZ *> rows;
+
+	ptw.add_line(">>>Names and values of the input signals");
+	rows.push_back(NULL);
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		if((*p)->is_selected()) {
+			ptw.add_row(*p);
+			rows.push_back(*p);
+		}
+		p++;
+	}
+	ptw.add_line(">>>Names and values of the output signals");
+	rows.push_back(NULL);
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		if((*p)->is_selected()) {
+			ptw.add_row(*p);
+			rows.push_back(*p);
+		}
+		p++;
+	}
+	ptw.write();
+
+	if(write_table_index) {
+		table_index ti;
+		for(size_t i=0; i<rows.size(); i++) {
+			if(rows[i] != NULL) {
+				ti.add_row(rows[i]->get_name(), ptw.get_line_offset(i),
+					ptw.get_value_offset(i), rows[i]->get_sig_values().size());
+			}
+		}
+		ti.set_chunks(num_slice_cycles(), index_stride, cycle_index);
+		ti.write(table_index::index_filename(out_file), outputfile.bytes_written());
+	}
+}
+
+
+
+/**
+ * Function to write the signals to the output file as the vector-major
+ * table, which holds a row of all signals for each quantum of time
+ * The rows of each cycle are aligned by the cycle index, of every cycle
+ * @return nothing
+ */
+void file_analyzer::dump_vector_output() {
+	MEM_SCOPE(MEM_OUTPUT);
+	vector_writer vw(outputfile);
+
+	sig_l_p p = list_of_ip_signals.begin();
+	while(p != list_of_ip_signals.end()) {
+		if((*p)->is_selected()) {
+			vw.add_signal((*p)->get_name(), (*p)->get_sig_values());
+		}
+		p++;
+	}
+	p = list_of_op_signals.begin();
+	while(p != list_of_op_signals.end()) {
+		if((*p)->is_selected()) {
+			vw.add_signal((*p)->get_name(), (*p)->get_sig_values());
+		}
+		p++;
+	}
+
+	vw.set_cycle_index(cycle_index);
+	vw.write();
+}
+
+
+
+/**
+ * Function to bypass the page cache when the output file is written
+ * @param enable is true if direct I/O (O_DIRECT) is to be used
+ * @return true if direct I/O is in use; the file system may not support it
+ */
+bool file_analyzer::set_direct_io(bool enable) {
+	return outputfile.set_direct_io(enable);
+}
+
+
+
+/**
+ * Function to drop the written pages of the output file from the page cache
+ * @param enable is true if the written pages are to be dropped
+ * @return nothing
+ */
+void file_analyzer::set_fadvise(bool enable) {
+	outputfile.set_fadvise(enable);
 }
 
 
@@ -261,9 +1269,7 @@ void file_analyzer::print_output_ln(string current_ln) {
  * O(1); COMPLETED
  */
 void file_analyzer::close_io_streams() {
-	// Close the input filestream
-	inputfile.close();
-	// Close the output filestream
+	// The input file is closed once it is compiled; close the output filestream
 	outputfile.close();
 }
 
@@ -316,19 +1322,10 @@ str_l_p file_analyzer::find_token(string key) {
  * @return nothing
  */
 void file_analyzer::process_pattern_blk() {
-cout<<">>>>>>>>>>>>>>>>>>>>>>void file_analyzer::process_pattern_blk()"<<endl;
-	/**
-	 * Counter to indicate the number of tokens being processed
-	 * Hence, they indicate the number of tokens that shall be skipped
-	 * after a method/function call
-	 * This avoids the need to keep track of the pointer location, upon the
-	 * return of the method/function call
-	 */
-	int num_tkns=0;
-
+TRACE(TRACE_PATTERN, TRACE_DEBUG, ">>>>>>>>>>>>>>>>>>>>>>void file_analyzer::process_pattern_blk()");
 	// Search for the keyword "Pattern"...
 	str_l_p ptn = find_token(PATTERN);
-cout<<"\t\tPATTERN\t\tFOUND\t\tPATTERN\t\tFOUND"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t\tPATTERN\t\tFOUND\t\tPATTERN\t\tFOUND");
 	// Assertion...
 	if(ptn == list_tokens.end()) {
 		cerr<<"Keyword "<<PATTERN<<" is not found!"<<endl;
@@ -362,7 +1359,30 @@ Example of how to search for a string and access its neighbours
 	 * and its content (open curly bracket)
 	 */
 	
-cout << "!@#$%^&*()_+Str found is:::" << (*ptn) << endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "!@#$%^&*()_+Str found is:::" << (*ptn));
+	execute_pattern(ptn);
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "-------->>>>PATTERN BLOCK HAS BEEN PROCESSED");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::process_pattern_blk()");
+}
+
+
+
+/**
+ * Function to execute the statements of the Pattern block, from a statement
+ * to the end of the block, or of the slice
+ * @param ptn is the first token to be processed
+ * @return nothing
+ */
+void file_analyzer::execute_pattern(str_l_p ptn) {
+	/**
+	 * Counter to indicate the number of tokens being processed
+	 * Hence, they indicate the number of tokens that shall be skipped
+	 * after a method/function call
+	 * This avoids the need to keep track of the pointer location, upon the
+	 * return of the method/function call
+	 */
+	int num_tkns=0;
+
 	/**
 	 * While the next token isn't a close bracket that ends this block...
 	 * Process the contents of the pattern block
@@ -373,114 +1393,118 @@ cout << "!@#$%^&*()_+Str found is:::" << (*ptn) << endl;
 	 */
 	while((ptn != list_tokens.end()) && (ptn != list_tokens.begin())) {
 //	while(ptn != list_tokens.end()) {
-cout<<"My\tCurrent\tToken\tis=="<<(*ptn)<<"::::############"<<endl;
+		// Stop once the last cycle of the slice has been executed
+		if(slice_done) {
+			break;
+		}
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "My\tCurrent\tToken\tis=="<<(*ptn)<<"::::############");
 		// If this token is a close bracket that closes this block...
 		if(search_key_found(CLOSE_BRACKET,(*ptn)) && (list_blocks.empty()) ) {
-cout<<"CLOSE BRACKET#################################"<<endl;
-cout << "Close Bracket Token is found===" << (*ptn) << endl;
-cout<<"\t\tTOKEN\t\tFOUND\t\tTOKEN\t\tFOUND"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "CLOSE BRACKET#################################");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Close Bracket Token is found===" << (*ptn));
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t\tTOKEN\t\tFOUND\t\tTOKEN\t\tFOUND");
 			// End of Pattern block...
 			break;
 		}else if((*ptn)==MACRO) {
-cout<<"MACRO#################################"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "MACRO#################################");
 			// Macro keyword is found... Process it
 			
 			// Get the pointer to the name of the macro...
 			ptn++;
-cout << "Macro Token is found===" << (*ptn)<<"><"<< endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Macro Token is found===" << (*ptn)<<"><");
 			str_list sl = delimit_string(*ptn);
-cout << "Macro TokenIZED===" << sl.front()<<"><"<< endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Macro TokenIZED===" << sl.front()<<"><");
 			// Process this macro definition
 //			ptn=process_macro_blk(sl.front());
 			process_macro_blk(sl.front());
-cout<<"\t\tMACRO\t\tFOUND\t\tMACRO\t\tMACRO"<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<"--Macro has been processed --"<<endl;
-cout<<"--Macro has been processed --"<<endl;
-cout<<"--Macro has been processed --"<<endl;
-cout<<"--Macro has been processed --"<<endl;
-cout<<"--Macro has been processed --"<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t\tMACRO\t\tFOUND\t\tMACRO\t\tMACRO");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "--Macro has been processed --");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "--Macro has been processed --");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "--Macro has been processed --");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "--Macro has been processed --");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "--Macro has been processed --");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
 // BEGIN DEBUG HERE
 // Skip to the next valid token; skip 3 tokens
 //break;
 		}else if(truncate_semicolon(*ptn)==SCANLOAD) {
-cout<<"SCAN LOAD#################################"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "SCAN LOAD#################################");
 // RESUME DEBUGGING HERE... till the end of the function
 
 			// scanProc keyword is found... Process it
 			num_tkns=process_scanproc_blk(*ptn);
 //			num_tkns++;
 //			num_tkns++;
-cout<<"NUm Tokens is:::"<<num_tkns<<endl;
-cout<<"\t\tSCANLOAD\t\tFOUND\t\tSCANLOAD\t\tFOUND"<<endl;
-cout<<"((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<"((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "NUm Tokens is:::"<<num_tkns);
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t\tSCANLOAD\t\tFOUND\t\tSCANLOAD\t\tFOUND");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((");
 //check_scan_block();
 		}else if(truncate_semicolon(*ptn)==SCANUNLOAD) {
-cout<<"&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&"<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<""<<endl;
-cout<<"&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&"<<endl;
-cout<<"SCAN UNLOAD#################################"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "SCAN UNLOAD#################################");
 // RESUME DEBUGGING HERE... till the end of the function
 
 			// scanProc keyword is found... Process it
 			num_tkns=process_scanproc_blk(*ptn);
 			num_tkns++;
 			num_tkns++;
-cout<<"NUm Tokens is:::"<<num_tkns<<endl;
-cout<<"\t\tSCANUNLOAD\t\tFOUND\t\tSCANUNLOAD\t\tFOUND"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "NUm Tokens is:::"<<num_tkns);
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t\tSCANUNLOAD\t\tFOUND\t\tSCANUNLOAD\t\tFOUND");
 //check_scan_block();
 		}else if((*ptn)==V) {
-cout<<"VVVVVVV#####################::::"<<(*ptn)<<"::::############"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "VVVVVVV#####################::::"<<(*ptn)<<"::::############");
 			// V keyword is found... Process it
 num_tkns=process_v_blk(ptn,V);
 num_tkns=num_tkns*2;
 num_tkns--;
 num_tkns--;
 //ptn--;
-cout<<"\t\tVVV\t\tFOUND\t\tVVV\t\tFOUND"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t\tVVV\t\tFOUND\t\tVVV\t\tFOUND");
 check_signal_condition();
 check_signal_value();
 		}
@@ -488,7 +1512,7 @@ check_signal_value();
 		// Skip the required number of tokens to process the next subpattern
 		while(num_tkns>0) {
 			num_tkns--;
-cout<<"<<<\t<<<\t<<<\t<<< CURRENT TOKEN"<<(*ptn)<<"><"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "<<<\t<<<\t<<<\t<<< CURRENT TOKEN"<<(*ptn)<<"><");
 			ptn++;
 		}
 		
@@ -498,12 +1522,10 @@ cout<<"<<<\t<<<\t<<<\t<<< CURRENT TOKEN"<<(*ptn)<<"><"<<endl;
 			break;
 		}
 		
-cout<<"<<<\t<<<\t<<<\t<<< NEXT TOKEN"<<(*ptn)<<"><"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "<<<\t<<<\t<<<\t<<< NEXT TOKEN"<<(*ptn)<<"><");
 		// Else, process the next token...
 		ptn++;
 	}	// Pattern block has been processed
-cout << "-------->>>>PATTERN BLOCK HAS BEEN PROCESSED" << endl;
-cout<<"<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::process_pattern_blk()"<<endl;
 }
 
 
@@ -519,7 +1541,9 @@ cout<<"<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::process_pattern_blk()"<<endl;
  * @return nothing  
  */
 void file_analyzer::process_macro_blk(string macro_name) {
-cout<<">>>>>>>>>void file_analyzer::process_macro_blk(string macro_name)"<<endl;
+	run_stats::scope guard(stats, run_stats::PHASE_MACRO,
+		macro_name.c_str());
+TRACE(TRACE_PATTERN, TRACE_DEBUG, ">>>>>>>>>void file_analyzer::process_macro_blk(string macro_name)");
 	/**
 	 * Counter to indicate the number of tokens being processed
 	 * Hence, they indicate the number of tokens that shall be skipped
@@ -529,7 +1553,7 @@ cout<<">>>>>>>>>void file_analyzer::process_macro_blk(string macro_name)"<<endl;
 	 */
 	int num_tkns=0;
 
-cout << "\t MARCRONAME" << macro_name <<"*************************"<< endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t MARCRONAME" << macro_name <<"*************************");
 	// Search for this macro definition 
 	str_l_p  m_p = find_token(macro_name);
 	
@@ -542,18 +1566,22 @@ cout << "\t MARCRONAME" << macro_name <<"*************************"<< endl;
 	// Determine the initial number of parentheses encasing the blocks...
 	int num_brackets = list_blocks.size();
 	// Proceed to the first token after the open curly bracket
-cout << "1TOKEN IS@@@" << (*m_p) << endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "1TOKEN IS@@@" << (*m_p));
 	m_p++;
-cout << "2TOKEN IS@@@" << (*m_p) << endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "2TOKEN IS@@@" << (*m_p));
 	m_p++;
-cout << "3TOKEN IS@@@" << (*m_p) << endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "3TOKEN IS@@@" << (*m_p));
 	// Process this macro definition...
 	while(m_p != list_tokens.end()) {
+		// Stop once the last cycle of the slice has been executed
+		if(slice_done) {
+			return;
+		}
 		// If this token is a close bracket that closes this block...
 		if(search_key_found(CLOSE_BRACKET,(*m_p)) && (list_blocks.size()==num_brackets) ) {
 		//if(search_key_found(CLOSE_BRACKET,(*m_p))) {
-cout<<"END OF PATTERN BLOCK------>>>>>>>END OF PATTERN BLOCK"<<endl;
-cout<<"<<<<<<<<<void file_analyzer::process_macro_blk(string macro_name)"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "END OF PATTERN BLOCK------>>>>>>>END OF PATTERN BLOCK");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "<<<<<<<<<void file_analyzer::process_macro_blk(string macro_name)");
 			// End of Pattern block...
 			return;
 //		}else if((*m_p)==W) {
@@ -562,7 +1590,7 @@ cout<<"<<<<<<<<<void file_analyzer::process_macro_blk(string macro_name)"<<endl;
 			m_p++;
 			// Get the name of the macro...
 			str_list sl = delimit_string(*m_p);
-cout << "W !!TokenIZED===------>>>>>>------>>>>>>" << sl.front() << endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "W !!TokenIZED===------>>>>>>------>>>>>>" << sl.front());
 			// Process this macro definition
 num_tkns=process_waveform_blk(sl.front());
 num_tkns=0;
@@ -584,21 +1612,21 @@ num_tkns=0;
 // $DISPLAY Waveform properties...
 check_waveform();
 
-cout<<"************************COMPLETE waVeFrOm prOcEsSInG"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "************************COMPLETE waVeFrOm prOcEsSInG");
 		}else if(search_key_found(V,(*m_p)) ) {
 			// scanProc keyword is found... Process it
-cout<<"~~~~~~~~~~~~~~~~~~~~~~V block is found"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "~~~~~~~~~~~~~~~~~~~~~~V block is found");
 num_tkns=process_v_blk(m_p,V);
 // Number of tokens exceeded count by 1
-cout << "V !!TokenIZED===------>>>>>>------>>>>>>" << endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "V !!TokenIZED===------>>>>>>------>>>>>>");
 check_signal_condition();
 check_signal_value();
 //		}else if((*m_p)==C) {
 		}else if(search_key_found(C,(*m_p)) ) {
 			// V keyword is found... Process it
-cout<<"~~~~~~~~~~~~~~~~~~~~~~C block is found"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "~~~~~~~~~~~~~~~~~~~~~~C block is found");
 num_tkns=process_v_blk(m_p,C);
-cout << "C !!TokenIZED===------>>>>>>------>>>>>>" << endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "C !!TokenIZED===------>>>>>>------>>>>>>");
 num_tkns--;
 check_signal_condition();
 check_signal_value();
@@ -606,35 +1634,35 @@ check_signal_value();
 // Handle the blocks here...
 		if(search_key_found(OPEN_BRACKET,(*m_p))) {
 			list_blocks.push_back(*m_p);
-cout<<"~~~~~~~~~~~~~~~~~~~~~~OPEN bracket is found"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "~~~~~~~~~~~~~~~~~~~~~~OPEN bracket is found");
 		}else if(search_key_found(CLOSE_BRACKET,(*m_p))) {
 			list_blocks.pop_back();
-cout<<"~~~~~~~~~~~~~~~~~~~~~~CLOSE bracket is found"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "~~~~~~~~~~~~~~~~~~~~~~CLOSE bracket is found");
 		}
-cout<<"\t\t\t\t\t Process next waveform tokeee"<<endl;
-cout<<"THE NUMBER OF TOKENS that are skipped in this loop are<>"<<num_tkns<<"<>"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t\t\t\t\t Process next waveform tokeee");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "THE NUMBER OF TOKENS that are skipped in this loop are<>"<<num_tkns<<"<>");
 		// Skip the processed tokens... move to the next unprocessed token
 		while(num_tkns > 0) {
 			num_tkns--;
 			m_p++;
-cout<<"SKIPPED TOKEN IS:::::::::::::::::::::::::::"<<(*m_p)<<"<>"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "SKIPPED TOKEN IS:::::::::::::::::::::::::::"<<(*m_p)<<"<>");
 		}
 		
 		// Else, process the next token...
 		m_p++;
 		
 		if(search_key_found(PATTERN,(*m_p))) {
-			cout<<"END OF PATTERN BLOCK------>>>>>>>END OF PATTERN BLOCK"<<endl;
-cout<<"<<<<<<<<<void file_analyzer::process_macro_blk(string macro_name)"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "END OF PATTERN BLOCK------>>>>>>>END OF PATTERN BLOCK");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "<<<<<<<<<void file_analyzer::process_macro_blk(string macro_name)");
 			// End of Pattern block...
 			return;
 		}
 		
-cout<<"\t\t\t\t\t Processed next "<<(*m_p)<<" waveform tokeee"<<endl;
-cout<<"\t\t\t\t\t xxxxxxxxxxxxxxxxxxxxx\tNext Token\tDOnE"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t\t\t\t\t Processed next "<<(*m_p)<<" waveform tokeee");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t\t\t\t\t xxxxxxxxxxxxxxxxxxxxx\tNext Token\tDOnE");
 	}	// macro block has been processed
 	
-cout<<"<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<process macro blk"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<process macro blk");
 	string err_msg="Close bracket for macro definition CANNOT BE FOUND!!!";
 // UNCOMMENT THIS AFTER THE METHOD DEFINTIONS FOR C AND V
 //	throw ViolatedAssertion(err_msg);
@@ -656,7 +1684,8 @@ cout<<"<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<process macro blk"<<endl;
  * O(n) computational time complexity; COMPLETED
  */
 int file_analyzer::process_waveform_blk(string wave) {
-cout<<">>>>>>>>>>>>int file_analyzer::process_waveform_blk(string wave)"<<endl;
+	run_stats::scope guard(stats, run_stats::PHASE_W);
+TRACE(TRACE_TIMING, TRACE_DEBUG, ">>>>>>>>>>>>int file_analyzer::process_waveform_blk(string wave)");
 	
 	/**
 	 * Counter to indicate the number of tokens being processed by another
@@ -685,23 +1714,23 @@ cout<<">>>>>>>>>>>>int file_analyzer::process_waveform_blk(string wave)"<<endl;
 	// Determine the initial number of parentheses encasing the blocks...
 	int num_brackets = list_blocks.size();
 	// Proceed to the first token after the open curly bracket
-cout << "1TOKEN" << (*w) << endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "1TOKEN" << (*w));
 	w++;
 	num_tkns++;
-cout << "2TOKEN" << (*w) << endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "2TOKEN" << (*w));
 	w++;
 	num_tkns++;
-cout << "3TOKEN" << (*w) << endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "3TOKEN" << (*w));
 	// Process this macro definition...
 	while(w != list_tokens.end()) {
 		// If this token is a close bracket that closes this block...
 		if(search_key_found(CLOSE_BRACKET,(*w)) && (list_blocks.size()==num_brackets) ) {
-cout<<"<<<<<<<<<<<<int file_analyzer::process_waveform_blk(string wave)"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "<<<<<<<<<<<<int file_analyzer::process_waveform_blk(string wave)");
 			// End of Pattern block...
 			return num_tkns;
 		}else if(search_key_found(CLOSE_BRACKET,(*w))) {
-cout<<"Reached definition of next set of waveform properties"<<endl;
-cout<<"<<<<<<<<<<<<int file_analyzer::process_waveform_blk(string wave)"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Reached definition of next set of waveform properties");
+TRACE(TRACE_TIMING, TRACE_DEBUG, "<<<<<<<<<<<<int file_analyzer::process_waveform_blk(string wave)");
 			// End of Pattern block...
 			return num_tkns;
 //		}else if((*w)==PERIOD) {
@@ -713,57 +1742,57 @@ cout<<"<<<<<<<<<<<<int file_analyzer::process_waveform_blk(string wave)"<<endl;
 			str_list sl = delimit_string(*w);
 
 			string cycle_time = sl.front();
-			cycle_time=chop_ns(cycle_time);
-cout << "Cycle time is&&&" << cycle_time << endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Cycle time is&&&" << cycle_time);
 
-			// Assign the period of the waveform...
-			period_t = atoi(cycle_time.c_str());
+			// Assign the period of the waveform, in picoseconds...
+			period_t = parse_time(cycle_time);
+			record_wft(wave, period_t);
 			update_sig_period(period_t);
-cout << "\t\t\tNEW Cycle time is&&&" << period_t << endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\tNEW Cycle time is&&&" << period_t);
 			// Skip 2 tokens to deal with signal values
 			w++;
 			num_tkns++;
-cout << "single&&incre" << (*w) << endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "single&&incre" << (*w));
 			w++;
 			num_tkns++;
-cout << "double&&incre" << (*w) << endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "double&&incre" << (*w));
 //cout << "\t\t\t Uh Oh!!!"<<endl;
 		// Completed...
 //		}else if((*w)==PIPINS) {
 		}else if(search_key_found(PIPINS,(*w)) ) {
 			// PIPINS keyword is found... Process it
-cout<<"\t\t\tProcess INPUT signal waveform properties"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\tProcess INPUT signal waveform properties");
 			num_tokens_traversed=process_pipins(w);
 num_tokens_traversed++;
-cout<<"\t\t\tProcessED INput signal waveform properties"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\tProcessED INput signal waveform properties");
 //break;
 //		}else if((*w)==POPINS) {
 		}else if(search_key_found(POPINS,(*w)) ) {
 			// POPINS keyword is found... Process it
-cout<<"\t\t\tProcess output signal waveform properties"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\tProcess output signal waveform properties");
 			num_tokens_traversed=process_popins(w);
 num_tokens_traversed++;
-cout<<"\t\t\t!!!Processed output signal waveform properties"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\t!!!Processed output signal waveform properties");
 //			process_v_blk();
 //break;
 //		}else if((*w)==MASTERCLK) {
 		}else if(search_key_found(MASTERCLK,(*w)) ) {
 			// MASTERCLK keyword is found... Process it
 //			process_v_blk();
-cout<<"\t\t\t\t\t Get dEtAIls of tHE mAsTEr cLoCK"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\t\t\t Get dEtAIls of tHE mAsTEr cLoCK");
 			num_tokens_traversed=process_clk(w,MASTERCLK);
 num_tokens_traversed++;
 num_tokens_traversed++;
 num_tokens_traversed++;
-cout<<"\t\t\t\t\t mAsTEr cLoCK hAs BeEN pRoCeSSeD"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\t\t\t mAsTEr cLoCK hAs BeEN pRoCeSSeD");
 //break;
 //		}else if((*w)==SCANCLK) {
 		}else if(search_key_found(SCANCLK,(*w)) ) {
 			// SCANCLK keyword is found... Process it
 //			process_v_blk();
-cout<<"\t\t\t\t\t Get dEtAIls of tHE SCAN cLoCK"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\t\t\t Get dEtAIls of tHE SCAN cLoCK");
 			num_tokens_traversed=process_clk(w,SCANCLK);
-cout<<"\t\t\t\t\t SCAN cLoCK hAs BeEN pRoCeSSeD"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\t\t\t SCAN cLoCK hAs BeEN pRoCeSSeD");
 //break;
 num_tokens_traversed++;
 num_tokens_traversed++;
@@ -782,19 +1811,19 @@ num_tokens_traversed++;
 			num_tokens_traversed--;
 			w++;
 			num_tkns++;
-cout<<"Token skipped:"<< (*w) <<"><=="<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Token skipped:"<< (*w) <<"><==");
 		}
 //		w++;
 		
 		// Else, process the next token...
-cout<<"\t\t\t\tyet to crash dump"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\t\tyet to crash dump");
 		w++;
 		num_tkns++;
-cout<<"Tokie WWWis:"<<(*w)<<endl;
-cout<<"\t\t\t\t crash dump???"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Tokie WWWis:"<<(*w));
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\t\t crash dump???");
 	}	// macro block has been processed
 	
-cout<<"ENDmacroBlK"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "ENDmacroBlK");
 string err_str;
 err_str="Macro definition is not properly defined: missing close brackets";
 throw ViolatedAssertion(err_str);
@@ -809,7 +1838,8 @@ throw ViolatedAssertion(err_str);
  * O(n); COMPLETED
  */
 str_list file_analyzer::delimit_string(string delimit_str) {
-cout<<">>>>>>>>>>>>>>>str_list file_analyzer::delimit_string(string delimit_str)"<<endl;
+	MEM_SCOPE(MEM_TOKENS);
+TRACE(TRACE_TOKENS, TRACE_DEBUG, ">>>>>>>>>>>>>>>str_list file_analyzer::delimit_string(string delimit_str)");
 	// Storage of delimited strings containing values to be processed
 	str_list list_str;
 	// Temporary string to process current token...
@@ -905,7 +1935,7 @@ cout<<">>>>>>>>>>>>>>>str_list file_analyzer::delimit_string(string delimit_str)
 	if((num_apostrophes%2) != 0) {
 		throw ViolatedAssertion("Matching apostrophes NOT found!!!");
 	}
-cout<<"<<<<<<<<<<<<<<<str_list file_analyzer::delimit_string(string delimit_str)"<<endl;
+TRACE(TRACE_TOKENS, TRACE_DEBUG, "<<<<<<<<<<<<<<<str_list file_analyzer::delimit_string(string delimit_str)");
 	// Return the list of delimited tokens...
 	return list_str;
 }
@@ -918,13 +1948,13 @@ cout<<"<<<<<<<<<<<<<<<str_list file_analyzer::delimit_string(string delimit_str)
  * @param logic_value is the boolean logic value that a signal should take
  * @return a string indicating a sequence of quantized values for this signal
  * i.e., a signal of 30ns duration is broken up into a sequence of values in
- * the defined quantized units of time... "MEASURE_OF_TIME" amount of time in
+ * the defined quantized units of time... "measure_of_time" amount of time in
  * UNIT_OF_TIME units of time
  * O(n) computational time complexity; COMPLETED
  */
 string file_analyzer::time_to_string(int duration, int logic_value) {
 	// Can the duration be represented as quantized units of time
-	if((duration%MEASURE_OF_TIME) != 0) {
+	if((duration%measure_of_time) != 0) {
 		string err="The duration cannot be measured in quantized units of time";
 		throw ViolatedPrecondition(err);
 	}
@@ -933,7 +1963,7 @@ string file_analyzer::time_to_string(int duration, int logic_value) {
 	string signal_values="";
 	// Logic value during a selected 5ns interval
 	string logic_v=int_to_str(logic_value);
-	for(int i=0; i<duration; i=i+MEASURE_OF_TIME) {
+	for(int i=0; i<duration; i=i+measure_of_time) {
 		//signal_values=signal_values+""+logic_value;
 		signal_values=signal_values.insert(signal_values.size(),logic_v);
 	}
@@ -1021,6 +2051,65 @@ string file_analyzer::chop_ns(string clk_time) {
 
 
 
+/**
+ * Function to convert a time, such as "50ns", into picoseconds
+ * The time is converted once, when the WaveformTable is compiled, so that
+ * the signals can be expanded without any string handling
+ * @param t is the time with its units; if its units are missing, the time
+ *	is assumed to be in UNIT_OF_TIME
+ * @throws ViolatedAssertion exception if the time or its units are invalid
+ * @return the time in picoseconds
+ * O(n) computational time complexity; COMPLETED
+ */
+int64_t file_analyzer::parse_time(string t) {
+	// Index of the first character after the digits of the time
+	int i=0;
+	// Integral part of the time
+	int64_t whole=0;
+	// Fractional part of the time, and its scale
+	int64_t fraction=0;
+	int64_t scale=1;
+
+	// Accumulate the integral part of the time...
+	while((i<t.size()) && isdigit(t[i])) {
+		whole = whole*10 + (t[i]-'0');
+		i++;
+	}
+	// Accumulate the fractional part of the time, if any...
+	if((i<t.size()) && (t[i]=='.')) {
+		i++;
+		while((i<t.size()) && isdigit(t[i])) {
+			fraction = fraction*10 + (t[i]-'0');
+			scale = scale*10;
+			i++;
+		}
+	}
+	if(i == 0) {
+		cerr<<"Time is:"<<t<<"<:::"<<endl;
+		throw ViolatedAssertion("Time is not a number");
+	}
+
+	// Number of picoseconds in the units of this time
+	int64_t ps_per_unit;
+	string units=t.substr(i);
+	if(units.empty() || (units==UNIT_OF_TIME)) {
+		ps_per_unit=signalZ::PS_PER_UNIT_OF_TIME;
+	}else if(units=="ps") {
+		ps_per_unit=1;
+	}else if(units=="us") {
+		ps_per_unit=1000000;
+	}else if(units=="ms") {
+		ps_per_unit=1000000000;
+	}else{
+		cerr<<"Time is:"<<t<<"<:::"<<endl;
+		throw ViolatedAssertion("Units of time are invalid");
+	}
+
+	return (whole*ps_per_unit) + ((fraction*ps_per_unit)/scale);
+}
+
+
+
 /**
  * Function to process the input pins of the module under test
  * This is included in the waveform block
@@ -1029,7 +2118,7 @@ string file_analyzer::chop_ns(string clk_time) {
  * O(n) computational time complexity; COMPLETED
  */
 int file_analyzer::process_pipins(str_l_p p) {
-cout<<">>>>>>>>>>>>>>>>>>>>>>int file_analyzer::process_pipins(str_l_p p)"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, ">>>>>>>>>>>>>>>>>>>>>>int file_analyzer::process_pipins(str_l_p p)");
 	/**
 	 * Flush the current waveform properties to load the new waveform properties
 	 * of this signal or set of signals
@@ -1050,16 +2139,18 @@ cout<<">>>>>>>>>>>>>>>>>>>>>>int file_analyzer::process_pipins(str_l_p p)"<<endl
 //cout<<"list_blocks.size()"<<list_blocks.size()<<endl;
 	// Temporary storage of wave properties for currently enumerated signals
 	signalZ::wave_prop ww;
+	// Time of the currently enumerated edge in picoseconds
+	int64_t edge_time;
 	// Determine the initial number of parentheses encasing the blocks...
 //	int num_brackets = list_blocks.size();
 	// Proceed to the first token after the open curly bracket
 
 	// Get the first triggering conditions of the signal...
 	p++;
-cout<<"1st move current numToKEN:"<<(*p)<<"<:::"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "1st move current numToKEN:"<<(*p)<<"<:::");
 	num_tokens++;
 	p++;
-cout<<"2nd move current numToKEN:"<<(*p)<<"<:::"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "2nd move current numToKEN:"<<(*p)<<"<:::");
 	num_tokens++;
 	// Truncate whitespace...
 	temp_holder = truncate_whitespace(*p);
@@ -1075,14 +2166,14 @@ cout<<"2nd move current numToKEN:"<<(*p)<<"<:::"<<endl;
 		// If signal is even, set it to be so...
 		if((even_or_odd%2)==0) {
 			(*ip_p)->toggle();
-cout<<"Signal is even"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "Signal is even");
 		}else{
-cout<<"Signal is odd"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "Signal is odd");
 		}
 	
 		// Assign trigger to currently enumerated input signal
 		(*ip_p)->set_trigger(temp_holder);
-cout<<"------- Set the trigger to be:"<<temp_holder<<": for the signal name:"<<(*ip_p)->get_name()<<":><"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "------- Set the trigger to be:"<<temp_holder<<": for the signal name:"<<(*ip_p)->get_name()<<":><");
 		// Proceed to the next input signal
 		ip_p++;
 		even_or_odd++;
@@ -1101,8 +2192,8 @@ cout<<"------- Set the trigger to be:"<<temp_holder<<": for the signal name:"<<(
 		// If this token is a close bracket that closes this block...
 		//if(search_key_found(CLOSE_BRACKET,(*p)) && (list_blocks.size()==num_brackets) ) {
 		if(search_key_found(CLOSE_BRACKET,(*p))) {
-cout<<"End of while >>><<< loop"<<list_blocks.size()<<endl;
-cout<<"<<<<<<<<<<<<<<<<<<<<<<int file_analyzer::process_pipins(str_l_p p)"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "End of while >>><<< loop"<<list_blocks.size());
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<<<<<int file_analyzer::process_pipins(str_l_p p)");
 			// End of Pattern block...
 			return num_tokens;
 		}else{
@@ -1115,14 +2206,13 @@ cout<<"<<<<<<<<<<<<<<<<<<<<<<int file_analyzer::process_pipins(str_l_p p)"<<endl
 			temp_holder = truncate_whitespace(*p);
 			// Delimit the string for non-alphanumeric characters...
 			t_l_p=delimit_string(temp_holder);
-			// Chop its units of time...
+			// Convert its time into picoseconds...
 			temp_holder=t_l_p.front();
-			temp_holder=chop_ns(temp_holder);
 			// Add it to the time property of these signals' waveform
-			ww.time=temp_holder;
+			edge_time=parse_time(temp_holder);
 			// And push it into list_blocks...
 //			list_blocks.push_back(temp_holder);
-cout<<"1QWERTY:::"<< temp_holder << endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "1QWERTY:::"<< temp_holder);
 			// Get its corresponding value...
 			p++;
 			num_tokens++;
@@ -1130,8 +2220,8 @@ cout<<"1QWERTY:::"<< temp_holder << endl;
 			temp_holder = truncate_whitespace(*p);
 			// Remove its semi-colon suffix...
 			temp_holder=truncate_semicolon(temp_holder);
-			// Add it to the logic value for these signals' waveform property
-			ww.logic_val=temp_holder;
+			// Compile the events for these signals' waveform property
+			ww=signalZ::make_wave_prop(edge_time,temp_holder);
 			// And push it into list_blocks...
 //			list_blocks.push_back(temp_holder);
 			
@@ -1148,14 +2238,14 @@ cout<<"1QWERTY:::"<< temp_holder << endl;
 			}
 		
 				
-cout<<"2QWERTY:::"<< temp_holder << endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "2QWERTY:::"<< temp_holder);
 		}
 		
 		// Process the next token...
 		p++;
 		num_tokens++;
 	}
-cout<<"End of while loop>>><<<"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "End of while loop>>><<<");
 }
 
 
@@ -1169,7 +2259,7 @@ cout<<"End of while loop>>><<<"<<endl;
  * COMPLETED
  */
 void file_analyzer::process_sig_grps() {
-cout<<">>>>>>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::process_sig_grps()"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, ">>>>>>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::process_sig_grps()");
 	// Find the groups of signals
 	str_l_p  w = find_token(SIGNALGROUPS);
 	
@@ -1194,7 +2284,7 @@ cout<<">>>>>>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::process_sig_grps()"<<endl;
 //		if(search_key_found(CLOSE_BRACKET,(*w)) && (list_blocks.size()==num_brackets) ) {
 		if(search_key_found(CLOSE_BRACKET,(*w)) || search_key_found(ALLPINS,(*w))) {
 			// End of Pattern block...
-cout<<"<<<<<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::process_sig_grps()"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::process_sig_grps()");
 			return;
 		}else if((*w)==PIPINS) {
 			// Skip its keyword token... PIPINS
@@ -1214,13 +2304,15 @@ cout<<"<<<<<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::process_sig_grps()"<<endl;
 			while(p != sl.end()) {
 				// Create an instance of signal
 				temp_sig = new signalZ(*p);
+				temp_sig->set_quantum(measure_of_time
+					* signalZ::PS_PER_UNIT_OF_TIME);
 				// Add this instance to the list of input signals
-cout<<"\t\t\t\t\tINPUTput sigNaLS are:::"<< (*p) <<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "\t\t\t\t\tINPUTput sigNaLS are:::"<< (*p));
 				list_of_ip_signals.push_back(temp_sig);
 				// Process next available input signal
 				p++;
 			}
-cout<<"---->Number of input signals:::"<<list_of_ip_signals.size()<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "---->Number of input signals:::"<<list_of_ip_signals.size());
 //		}else if((*w)==POPINS) {
 		}else if(search_key_found(POPINS,(*w)) ) {
 			// Skip its keyword token... POPINS
@@ -1240,20 +2332,22 @@ cout<<"---->Number of input signals:::"<<list_of_ip_signals.size()<<endl;
 			while(p != sl.end()) {
 				// Create an instance of signal
 				temp_sig = new signalZ(*p);
+				temp_sig->set_quantum(measure_of_time
+					* signalZ::PS_PER_UNIT_OF_TIME);
 				// Add this instance to the list of output signals
-cout<<"\t\t\t\t\tOUTput sigNaLS are:::"<< (*p) <<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "\t\t\t\t\tOUTput sigNaLS are:::"<< (*p));
 				list_of_op_signals.push_back(temp_sig);
 				// Process next available output signal
 				p++;
 			}
-cout<<"---->Number of output signals:::"<<list_of_op_signals.size()<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "---->Number of output signals:::"<<list_of_op_signals.size());
 		}		
 		
-cout<<"]]]]]]][[[[[[[[[]]]]] VALUE of str Tokee"<< (*w) <<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "]]]]]]][[[[[[[[[]]]]] VALUE of str Tokee"<< (*w));
 		// Else, process the next token...
 		w++;
 	}
-cout<<"---->All input and output signals are processed..."<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "---->All input and output signals are processed...");
 throw ViolatedAssertion("Expected close bracket is MISSING!!!");
 }
 
@@ -1341,8 +2435,12 @@ void file_analyzer::process_header() {
 	// Concatenate the date/day/month/year field
 	date_field.insert(date_field.size(),cur_field);
 	
-	// Print the respective date/day/month/year field to the output file
-	print_output_ln(date_field);
+	// Keep the respective date/day/month/year field...
+	test_date=date_field;
+	// ... and print it to the output file, if the output file is a table
+	if((output_format == FORMAT_TABLE) || (output_format == FORMAT_VECTOR)) {
+		print_output_ln(date_field);
+	}
 //cout<<"%%%%%%%%%%string is"<<date_field<<endl;
 }
 
@@ -1371,6 +2469,11 @@ string file_analyzer::truncate_whitespace(string s) {
  * O(n) computational time complexity; COMPLETED
  */
 void file_analyzer::dump_output() {
+MEM_SCOPE(MEM_OUTPUT);
+if(num_threads > 1) {
+	dump_output_parallel();
+	return;
+}
 // ############################################################################
 //signal *za = new signal("sigNamE");
 //za = signal("sigNamE");
@@ -1411,10 +2514,21 @@ zz->add_char('s');
 list_of_ip_signals.push_back(za);
 list_of_ip_signals.push_back(zz);
 */
+// Index of the rows of the table, if it is written
+table_index ti;
+// Offset of the current row
+uint64_t row_offset;
+
 print_output_ln(">>>Names and values of the input signals");
 sig_l_p p = list_of_ip_signals.begin();
 while(p != list_of_ip_signals.end()) {
-	(*p)->print_output_ln(outputfile);
+	if((*p)->is_selected()) {
+		row_offset=outputfile.bytes_written();
+		(*p)->print_output_ln(outputfile);
+		if(write_table_index) {
+			add_index_row(ti, *p, row_offset);
+		}
+	}
 	p++;
 }
 
@@ -1422,10 +2536,24 @@ print_output_ln(">>>Names and values of the output signals");
 
 p = list_of_op_signals.begin();
 while(p != list_of_op_signals.end()) {
-	(*p)->print_output_ln(outputfile);
+	if((*p)->is_selected()) {
+		row_offset=outputfile.bytes_written();
+		(*p)->print_output_ln(outputfile);
+		if(write_table_index) {
+			add_index_row(ti, *p, row_offset);
+		}
+	}
 	p++;
 }
 
+// Explicit flush point; the table of signals has been written
+outputfile.flush();
+
+if(write_table_index) {
+	ti.set_chunks(num_slice_cycles(), index_stride, cycle_index);
+	ti.write(table_index::index_filename(out_file), outputfile.bytes_written());
+}
+
 //logic_values a = {"NaWE","DWIE"};
 //print_output_ln(a.logic_name);
 // ############################################################################
@@ -1451,7 +2579,7 @@ string file_analyzer::truncate_semicolon(string s) {
  * O(n) computational time complexity; COMPLETED
  */
 int file_analyzer::process_popins(str_l_p p) {
-cout<<">>>>>>>>>>>>>>>>>>>>>int file_analyzer::process_popins(str_l_p p)"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, ">>>>>>>>>>>>>>>>>>>>>int file_analyzer::process_popins(str_l_p p)");
 	/**
 	 * Flush the current waveform properties to load the new waveform properties
 	 * of this signal or set of signals
@@ -1462,7 +2590,7 @@ cout<<">>>>>>>>>>>>>>>>>>>>>int file_analyzer::process_popins(str_l_p p)"<<endl;
 
 
 
-cout<<"$$$$$ENtereD processing of the output pins!::!!!"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$ENtereD processing of the output pins!::!!!");
 	// Number of tokens enumerated in this function
 	int num_tokes=0;
 	// Temporary holder used for delimiting tokens
@@ -1471,18 +2599,20 @@ cout<<"$$$$$ENtereD processing of the output pins!::!!!"<<endl;
 	str_list t_l_p;
 	// Temporary storage of wave properties for currently enumerated signals
 	signalZ::wave_prop ww;
+	// Time of the currently enumerated edge in picoseconds
+	int64_t edge_time;
 	// Proceed to the first token after the open curly bracket
 
 	// Get the first triggering conditions of the signal...
 	p++;
 	num_tokes++;
-cout<<"P's current value:"<<(*p)<<">::"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "P's current value:"<<(*p)<<">::");
 	p++;
 	if((*p).size()<3) {
 		p--;
-cout<<"CurVaLofP<3:"<<(*p)<<">::"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "CurVaLofP<3:"<<(*p)<<">::");
 	}else{
-cout<<"CurVaLofP>2:"<<(*p)<<">::"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "CurVaLofP>2:"<<(*p)<<">::");
 	}
 /*
 	p++;
@@ -1490,53 +2620,53 @@ cout<<"CurVaLofP>2:"<<(*p)<<">::"<<endl;
 */
 	// Truncate whitespace...
 	temp_holder = truncate_whitespace(*p);
-cout<<"$$$$$ temp HOLDER!!!"<<temp_holder<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$ temp HOLDER!!!"<<temp_holder);
 	// Assign this trigger to all output pins...
 	// Get the pointer to the first output signal
 	sig_l_p op_p = list_of_op_signals.begin();
 	// Flag to determine if this signal should be even...
 	int even_or_odd=1;
-cout<<"$$$$$ENtereD while loop!!!"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$ENtereD while loop!!!");
 	// For each output signal in the system/circuit
 	while(op_p != list_of_op_signals.end()) {
 		// If signal is even, set it to be so...
 		if((even_or_odd%2)==0) {
 			(*op_p)->toggle();
-cout<<"Signal is even"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "Signal is even");
 		}else{
-cout<<"Signal is odd"<<endl;		
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "Signal is odd");
 		}
 	
 		// Assign trigger to currently enumerated output signal
 		(*op_p)->set_trigger(temp_holder);
-cout<<"+++++++ assign the trigger to be:"<<temp_holder<<": for the OUTput signal name:"<<(*op_p)->get_name()<<":><"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "+++++++ assign the trigger to be:"<<temp_holder<<": for the OUTput signal name:"<<(*op_p)->get_name()<<":><");
 		// Proceed to the next output signal
 		op_p++;
 		even_or_odd++;
 	}
 	
-cout<<"$$$$$EXiteD while loop!!!"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$EXiteD while loop!!!");
 	// Get the first waveform property of the signal...
 
 	p++;
 	num_tokes++;
-cout<<"$$$$$ ---- string!!!"<<(*p)<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$ ---- string!!!"<<(*p));
 
 	p++;
-cout<<"aaCurrent val of p:"<<(*p)<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "aaCurrent val of p:"<<(*p));
 	num_tokes++;
 /*
 	p++;
 cout<<"bbCurrent val of p:"<<(*p)<<endl;
 	num_tokes++;
 */
-cout<<"$$$$$ENtereD NEXT	----	while loop!!!"<<(*p)<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$ENtereD NEXT	----	while loop!!!"<<(*p));
 	while(p != list_tokens.end()) {
 		// If this token is a close bracket that closes this block...
 		//if(search_key_found(CLOSE_BRACKET,(*p)) && (list_blocks.size()==num_brackets) ) {
 		if(search_key_found(CLOSE_BRACKET,(*p))) {
-cout<<"outputEnd of while >>><<< loop"<<endl;
-cout<<"<<<<<<<<<<<<<<<<<<<<<int file_analyzer::process_popins(str_l_p p)"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "outputEnd of while >>><<< loop");
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<<<<int file_analyzer::process_popins(str_l_p p)");
 			// End of Pattern block...
 			return num_tokes;
 		}else{
@@ -1544,26 +2674,25 @@ cout<<"<<<<<<<<<<<<<<<<<<<<<int file_analyzer::process_popins(str_l_p p)"<<endl;
 			 * For each output signal,set their time and logic values
 			 * for their wave properties
 			 */
-cout<<"$$$$$GET VALUE oF p!!!"<<endl;
-cout<<"val p:"<<(*p)<<"<:::"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$GET VALUE oF p!!!");
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "val p:"<<(*p)<<"<:::");
 			// Truncate whitespace of signal's waveform property (event/time)
 			temp_holder = truncate_whitespace(*p);
-cout<<"$$$$$no pointer prob with p!!!"<<endl;
-cout<<"val temp_holder:"<<temp_holder<<"<:::"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$no pointer prob with p!!!");
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "val temp_holder:"<<temp_holder<<"<:::");
 			// Delimit the string for non-alphanumeric characters...
 			t_l_p=delimit_string(temp_holder);
-cout<<"$$$$$ NO error with string delimiter!!!"<<endl;
-cout<<"$$$$$ sIZe of LiST:::"<<t_l_p.size()<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$ NO error with string delimiter!!!");
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$ sIZe of LiST:::"<<t_l_p.size());
 			// Chop its units of time...
 			temp_holder=t_l_p.front();
-cout<<"$$$$$ get 1st elem of the list of strings!!!"<<temp_holder<<endl;
-			temp_holder=chop_ns(temp_holder);
-cout<<"$$$$$ chop units of time!!!"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$ get 1st elem of the list of strings!!!"<<temp_holder);
 			// Add it to the time property of these signals' waveform
-			ww.time=temp_holder;
+			edge_time=parse_time(temp_holder);
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "$$$$$ convert units of time!!!");
 			// And push it into list_blocks...
-			list_blocks.push_back(temp_holder);
-cout<<"output1QWERTY:::"<< temp_holder << endl;
+			list_blocks.push_back(chop_ns(temp_holder));
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "output1QWERTY:::"<< temp_holder);
 			// Get its corresponding value...
 			p++;
 			num_tokes++;
@@ -1571,8 +2700,8 @@ cout<<"output1QWERTY:::"<< temp_holder << endl;
 			temp_holder = truncate_whitespace(*p);
 			// Remove its semi-colon suffix...
 			temp_holder=truncate_semicolon(temp_holder);
-			// Add it to the logic value for these signals' waveform property
-			ww.logic_val=temp_holder;
+			// Compile the events for these signals' waveform property
+			ww=signalZ::make_wave_prop(edge_time,temp_holder);
 			// And push it into list_blocks...
 //			list_blocks.push_back(temp_holder);
 			
@@ -1589,14 +2718,14 @@ cout<<"output1QWERTY:::"<< temp_holder << endl;
 			}
 		
 				
-cout<<"output2QWERTY:::"<< temp_holder << endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "output2QWERTY:::"<< temp_holder);
 		}
 		
 		// Process the next token...
 		p++;
 		num_tokes++;
 	}
-cout<<"outputEnd of while loop>>><<<"<<endl;
+TRACE(TRACE_SIGNALS, TRACE_DEBUG, "outputEnd of while loop>>><<<");
 }
 
 
@@ -1611,7 +2740,7 @@ cout<<"outputEnd of while loop>>><<<"<<endl;
  * O(n) computational time complexity; COMPLETED
  */
 int file_analyzer::process_clk(str_l_p p, string clk_type) {
-cout<<">>>>>>>>>>>>>>>int file_analyzer::process_clk(str_l_p p, string clk_type)"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, ">>>>>>>>>>>>>>>int file_analyzer::process_clk(str_l_p p, string clk_type)");
 	if((clk_type != SCANCLK) && (clk_type != MASTERCLK)) {
 		throw ViolatedPrecondition("Invalid clock type is used");
 	}
@@ -1632,23 +2761,25 @@ cout<<">>>>>>>>>>>>>>>int file_analyzer::process_clk(str_l_p p, string clk_type)
 	str_list t_l_p;
 	// Temporary storage of wave properties for currently enumerated signals
 	signalZ::wave_prop ww;
+	// Time of the currently enumerated edge in picoseconds
+	int64_t edge_time;
 	// Proceed to the first token after the open curly bracket
 
 	// Get the first triggering conditions of the signal...
 	p++;
-cout<<"The value of P is initially:"<<(*p)<<"]::"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "The value of P is initially:"<<(*p)<<"]::");
 	num_tokes++;
 	p++;
-cout<<"The value of P is now:"<<(*p)<<"]::"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "The value of P is now:"<<(*p)<<"]::");
 	num_tokes++;
 	// Truncate whitespace...
 	temp_holder = truncate_whitespace(*p);
-cout<<"\t\t\t\t\t TempHolDEr:::"<< temp_holder <<"[[["<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "\t\t\t\t\t TempHolDEr:::"<< temp_holder <<"[[[");
 	p++;
-cout<<"The value of P is now:"<<(*p)<<"]::"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "The value of P is now:"<<(*p)<<"]::");
 	num_tokes++;
 	p++;
-cout<<"The value of P is now:"<<(*p)<<"]::"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "The value of P is now:"<<(*p)<<"]::");
 	num_tokes++;
 	// Assign this trigger to the master/slave clock input pin...
 	// Get the pointer to the first input signal...
@@ -1659,7 +2790,7 @@ cout<<"The value of P is now:"<<(*p)<<"]::"<<endl;
 		// Is this input signal the master/slave clock?
 		if((*ip_p)->get_name()== clk_type) {
 			// Yes; get out of this loop
-cout<<"Clock type is found!!!"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Clock type is found!!!");
 			break;
 		}
 		
@@ -1676,10 +2807,10 @@ cout<<"Clock type is found!!!"<<endl;
 		 */
 		throw ViolatedAssertion("Master clock does not exist!");
 	}
-cout<<"Name of Clock Signal:"<<(*ip_p)->get_name()<<"]]]"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Name of Clock Signal:"<<(*ip_p)->get_name()<<"]]]");
 	// Set the condition of the clock signal
 	(*ip_p)->set_trigger((*p));
-cout<<"Trigger of Clock Signal:"<<(*ip_p)->get_trigger()<<"]]]"<<endl;	
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Trigger of Clock Signal:"<<(*ip_p)->get_trigger()<<"]]]");
 	
 	// Get the waveform properties of the signal...
 	
@@ -1693,8 +2824,8 @@ cout<<"Trigger of Clock Signal:"<<(*ip_p)->get_trigger()<<"]]]"<<endl;
 			num_tokes++;
 //			num_tokes++;
 //			num_tokes++;
-cout<<"The number of enumerated tokens for this process_clk function is:"<<num_tokes<<">s:::"<<endl;
-cout<<"<<<<<<<<<<<<<<<int file_analyzer::process_clk(str_l_p p, string clk_type)"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "The number of enumerated tokens for this process_clk function is:"<<num_tokes<<">s:::");
+TRACE(TRACE_TIMING, TRACE_DEBUG, "<<<<<<<<<<<<<<<int file_analyzer::process_clk(str_l_p p, string clk_type)");
 			// Return the number of tokens enumerated by this block...	
 			return num_tokes;
 		}else{
@@ -1705,23 +2836,22 @@ cout<<"<<<<<<<<<<<<<<<int file_analyzer::process_clk(str_l_p p, string clk_type)
 			
 			// Delimit the string for non-alphanumeric characters...
 			t_l_p=delimit_string(*p);
-cout<<"The pointer points to:"<<(*p)<<"###"<<endl;
-cout<<"Size of delimited timing property:"<<t_l_p.size()<<"###"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "The pointer points to:"<<(*p)<<"###");
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Size of delimited timing property:"<<t_l_p.size()<<"###");
 			/**
-			 * Remove the units of time for this timing waveform property
-			 * Add the timing property to the temporary waveform property struc
+			 * Convert this timing waveform property into picoseconds
 			 */
-			ww.time=chop_ns(t_l_p.front());
+			edge_time=parse_time(t_l_p.front());
 			
 			
 			// Get the logic value for its waveform property
 			p++;
-cout<<"Logic Val of P:"<<(*p)<<"<:::"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Logic Val of P:"<<(*p)<<"<:::");
 			// Delimit the string for non-alphanumeric characters...
 			t_l_p=delimit_string(*p);
-			// Add it to the waveform property
-			ww.logic_val=t_l_p.front();
-cout<<"Logic Val:"<<ww.logic_val<<"<:::"<<endl;
+			// Compile the events of the waveform property
+			ww=signalZ::make_wave_prop(edge_time,t_l_p.front());
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Logic Val:"<<t_l_p.front()<<"<:::");
 			
 			// Add it to the list of waveform properties...
 			(*ip_p)->add_wave_prop(ww);
@@ -1766,8 +2896,9 @@ cout<<"Logic Val:"<<ww.logic_val<<"<:::"<<endl;
  * O(n) computational time complexity; YET TO BE COMPLETED
  */
 int file_analyzer::process_v_blk(str_l_p p, string vector_type) {
-cout<<">>>>>>>>>>>>>>>>int file_analyzer::process_v_blk(str_l_p p, string vector_type)"<<endl;
-cout<<"ENter the vector/condition block"<<endl;
+	run_stats::scope guard(in_shift ? NULL : stats, run_stats::PHASE_V);
+TRACE(TRACE_PATTERN, TRACE_DEBUG, ">>>>>>>>>>>>>>>>int file_analyzer::process_v_blk(str_l_p p, string vector_type)");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "ENter the vector/condition block");
 // DEBUG THIS FUNCTION
 	// Number of tokens enumerated in this function
 	int num_tokes=0;
@@ -1791,13 +2922,6 @@ cout<<"ENter the vector/condition block"<<endl;
 	 */
 	bool is_hash=false;
 	
-	/**
-	 * Temporary holder for currently enumerated signal object
-	 * Since NULL evaluates to zero, use a dummy signal object for comparison
-	 * That is, if this signal's name is undefined, it is yet to be assigned
-	 * to an existing input or output signal
-	 */
-	signalZ *temp_sig_obj = new signalZ();
 	signalZ::wave_prop ww;
 	// Error message printed in standard error output
 	string err_msg;
@@ -1805,26 +2929,30 @@ cout<<"ENter the vector/condition block"<<endl;
 	
 	// Proceed to the first token after the open curly bracket
 
-cout<<"1P's val is:::"<< (*p) <<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "1P's val is:::"<< (*p));
 	// Get the first group of signals to process...
 	p++;
-cout<<"2P's val is:::"<< (*p) <<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "2P's val is:::"<< (*p));
 	num_tokes++;
 	p++;
-cout<<"3P's val is:::"<< (*p) <<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "3P's val is:::"<< (*p));
 	num_tokes++;
-cout<<"\t\t\t\t\t Sig-->TempHolDEr::: ENTER WHILE LOOP"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "\t\t\t\t\t Sig-->TempHolDEr::: ENTER WHILE LOOP");
 	
 	// Get the first waveform property of the signal...
 
 	// Process the values for various input and and output signals
 	while(p != list_tokens.end()) {
-cout<<"*******The next token that P is PoINtInG tI IS:"<<(*p)<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "*******The next token that P is PoINtInG tI IS:"<<(*p));
 		// If this token is a close bracket that closes this block...
 		if(search_key_found(CLOSE_BRACKET,(*p))) {
 			num_tokes++;
-cout<<"sig of while >>><<< loop::::::::"<<num_tokes<<endl;
-cout<<"<<<<<<<<<<<<<<<<int file_analyzer::process_v_blk(str_l_p p, string vector_type)"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "sig of while >>><<< loop::::::::"<<num_tokes);
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "<<<<<<<<<<<<<<<<int file_analyzer::process_v_blk(str_l_p p, string vector_type)");
+			// A vector completes a cycle of the pattern
+			if(vector_type == V) {
+				end_of_cycle();
+			}
 			// End of Pattern block...
 			return num_tokes;
 		}else{
@@ -1834,25 +2962,22 @@ cout<<"<<<<<<<<<<<<<<<<int file_analyzer::process_v_blk(str_l_p p, string vector
 			 * Attempt to delimit token...
 			 * Set the logic values for the input and output signals...
 			 */
-cout<<"cURreNt StrInG toKEN:::"<<(*p)<<">>>>"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "cURreNt StrInG toKEN:::"<<(*p)<<">>>>");
 current_token=(*p);
-			// Reset the temporary signal object for the next token to be processed
-			temp_sig_obj = new signalZ();
-			
 			// Delimit the string for non-alphanumeric characters...
 			t_l_p=delimit_string(*p);
 
 			// String token represents name of signal or signal vector
 			temp_sig_name=t_l_p.front();
-cout<<"String comparator<<<"<<current_token.substr(current_token.size()-2,1)<<":::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "String comparator<<<"<<current_token.substr(current_token.size()-2,1)<<":::");
 			// If the string token ends with a hash character "#" and ";"
 			if("#" == current_token.substr(current_token.size()-2,1)) {
 				// Set the is_hash flag to true for this signal
-cout<<"Last character of current string is  a HASH@@@"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Last character of current string is  a HASH@@@");
 				is_hash=true;
 			}
-cout<<"temp_sig_name IS~~~"<<temp_sig_name<<endl;
-cout<<"&&&\ttemp sig size IS~~~"<<t_l_p.size()<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "temp_sig_name IS~~~"<<temp_sig_name);
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "&&&\ttemp sig size IS~~~"<<t_l_p.size());
 			/**
 			 * Does this list of string tokens for this signal vector contain
 			 * one element or three elements?
@@ -1882,7 +3007,7 @@ cout<<"&&&\ttemp sig size IS~~~"<<t_l_p.size()<<endl;
 					 * delimit operation... Hence, this replaces it
 					 */
 					temp_sig_value="#";
-cout<<"Condition has HASH char:"<<temp_sig_value<<"<>"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Condition has HASH char:"<<temp_sig_value<<"<>");
 				}else{
 					/**
 					 * No... Skip the next two tokens to access its
@@ -1892,7 +3017,7 @@ cout<<"Condition has HASH char:"<<temp_sig_value<<"<>"<<endl;
 					p++;
 					// Assign the value of the signal to the current token
 					temp_sig_value=(*p);
-cout<<"Condition has NO hash char:"<<(*p)<<"<>"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Condition has NO hash char:"<<(*p)<<"<>");
 				}
 
 				// Process logic values of corresponding signal(s)
@@ -1905,7 +3030,7 @@ cout<<"Condition has NO hash char:"<<(*p)<<"<>"<<endl;
 			}else if(t_l_p.size() == 2) {
 				
 				// The first token is the name of signal or signal vector
-cout<<"There exists 2 tokens"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "There exists 2 tokens");
 				/**
 				 * Pointer to the first element in the list of string tokens
 				 * The element is a signal or a signal vector
@@ -1914,10 +3039,10 @@ cout<<"There exists 2 tokens"<<endl;
 				temp_sig_name=(*sv_p);
 				sv_p++;
 				temp_holder=(*sv_p);
-cout<<"set condition/value"<<endl;
-cout<<"@~~~SIgNaME:"<<temp_sig_name<<":SigVal:"<<temp_holder<<":SigTyPe:"<<vector_type<<":::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "set condition/value");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "@~~~SIgNaME:"<<temp_sig_name<<":SigVal:"<<temp_holder<<":SigTyPe:"<<vector_type<<":::");
 				set_cond_or_val(temp_sig_name, temp_holder, vector_type);
-cout<<"condition/value is set"<<endl;			
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "condition/value is set");
 			}else{
 				cerr<<"String token for signal vector definition is found"<<endl;
 				throw ViolatedAssertion("Size of string token should be 1 or 3");
@@ -1927,12 +3052,12 @@ cout<<"condition/value is set"<<endl;
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 		}
-cout<<"next condition/value"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "next condition/value");
 		// Process the next token...
 		p++;
 		num_tokes++;
 	}
-cout<<"BlKvEnd of while loop>>><<<"<<endl;	
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "BlKvEnd of while loop>>><<<");
 }
 
 
@@ -1945,9 +3070,9 @@ cout<<"BlKvEnd of while loop>>><<<"<<endl;
  * @return nothing
  */
 void file_analyzer::set_cond_or_val(string sig_name, string sig_val, string sig_type) {
-cout<<">>>>>>>>>>>>>>>>>>void file_analyzer::set_cond_or_val(string sig_name, string sig_val, string sig_type)"<<endl;
-cout<<"name of Signal vector:"<<sig_name<<"<:::"<<endl;
-cout<<"values of Signal vector:"<<sig_val<<"<:::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, ">>>>>>>>>>>>>>>>>>void file_analyzer::set_cond_or_val(string sig_name, string sig_val, string sig_type)");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "name of Signal vector:"<<sig_name<<"<:::");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "values of Signal vector:"<<sig_val<<"<:::");
 	// Temporary pointer to a signal's given value in the signal vector
 	int val_index=0;
 	
@@ -1962,47 +3087,47 @@ cout<<"values of Signal vector:"<<sig_val<<"<:::"<<endl;
 	// Indicate the index i of the i^{th} traversed character
 	int traversed_i=0;
 
-cout<<"Set condition or value for this signal in set_cond_or_val blk"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Set condition or value for this signal in set_cond_or_val blk");
 	// Check if element is an input signal vector
 	if(sig_name==PIPINS) {
-cout<<"Group of signals found is the input signals"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Group of signals found is the input signals");
 		// Enumerate each input signal
 		temp_s_l_p = list_of_ip_signals.begin();
 		while(temp_s_l_p != list_of_ip_signals.end()) {
-cout<<"NameOfSignal:"<<(*temp_s_l_p)->get_name()<<">:::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "NameOfSignal:"<<(*temp_s_l_p)->get_name()<<">:::");
 			if((val_index <= sig_val.size()) && (sig_type == C)) {
-cout<<"Signal's logic value::"<<sig_val.substr(val_index,1)<<":::"<<endl;
-cout<<"Signal's logic value::"<<sig_val<<":::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Signal's logic value::"<<sig_val.substr(val_index,1)<<":::");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Signal's logic value::"<<sig_val<<":::");
 				(*temp_s_l_p)->set_condition(sig_val.substr(val_index,1));
 
-cout<<"Go to the next signal"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Go to the next signal");
 				val_index++;
 
 			}else if(sig_type == V) {
 				(*temp_s_l_p)->sig_vector(sig_val);
-cout<<"Added the string:"<<sig_val<<">:::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Added the string:"<<sig_val<<">:::");
 			}else{
 				throw ViolatedAssertion("Signal type is INVALID!!!");
 			}
 
 			// Proceed to process the next value in this signal vector
 			temp_s_l_p++;
-cout<<"Proceed to the next token in the input signal group"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Proceed to the next token in the input signal group");
 		}
 	}else if(sig_name==POPINS) {
 		// Or if element is an output signal vector
-cout<<"Group of signals found is the output signals"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Group of signals found is the output signals");
 		// Enumerate each output signal
 		temp_s_l_p = list_of_op_signals.begin();
 		while(temp_s_l_p != list_of_op_signals.end()) {
 			
 			if(val_index < sig_val.size()) {
-cout<<"Signal's logic value::"<<sig_val.substr(val_index,1)<<":::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Signal's logic value::"<<sig_val.substr(val_index,1)<<":::");
 				if(sig_type == V) {
 					(*temp_s_l_p)->sig_vector(sig_val.substr(val_index,1));
-cout<<"Added the string:"<<sig_val.substr(val_index,1)<<">:::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Added the string:"<<sig_val.substr(val_index,1)<<">:::");
 				}else if(sig_type == C) {
-cout<<"DelIMiTED COndiTiON:"<<sig_val.substr(val_index,1)<<":::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "DelIMiTED COndiTiON:"<<sig_val.substr(val_index,1)<<":::");
 					(*temp_s_l_p)->set_condition(sig_val.substr(val_index,1));
 /*
 					if(sig_val.size() != 1) {
@@ -2018,15 +3143,15 @@ cout<<"Condition of sig:"<<sig_val<<">:::"<<endl;
 				}else{
 					throw ViolatedAssertion("Signal type is INVALID!!!");
 				}
-cout<<"Go to the next signal"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Go to the next signal");
 				val_index++;
 			}else{
-cout<<"Signal vector has more values than its number of elements!!!"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Signal vector has more values than its number of elements!!!");
 			}
 
 			// Proceed to process the next value in this signal vector
 			temp_s_l_p++;
-cout<<"Proceed to the next token in the output signal group"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Proceed to the next token in the output signal group");
 		}
 	}else{
 		/**
@@ -2036,7 +3161,7 @@ cout<<"Proceed to the next token in the output signal group"<<endl;
 		cerr<<"Signal vector is missing"<<endl;
 		throw ViolatedAssertion("Signal is found instead!");
 	}
-cout<<"<<<<<<<<<<<<<<<<<<void file_analyzer::set_cond_or_val(string sig_name, string sig_val, string sig_type)"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<void file_analyzer::set_cond_or_val(string sig_name, string sig_val, string sig_type)");
 }
 
 
@@ -2045,7 +3170,8 @@ cout<<"<<<<<<<<<<<<<<<<<<void file_analyzer::set_cond_or_val(string sig_name, st
  * @return the number of enumerated signals
  */
 int file_analyzer::process_scanproc_blk(string s) {
-cout<<">>>>>>>>>>>>>>>>>>>>>int file_analyzer::process_scanproc_blk(string s)"<<endl;
+	run_stats::scope guard(stats, run_stats::PHASE_CALL, s.c_str());
+TRACE(TRACE_SCAN, TRACE_DEBUG, ">>>>>>>>>>>>>>>>>>>>>int file_analyzer::process_scanproc_blk(string s)");
 	// Keep track of enumerated string tokens in the file
 	int enum_tokens=0;
 
@@ -2079,8 +3205,8 @@ cout<<">>>>>>>>>>>>>>>>>>>>>int file_analyzer::process_scanproc_blk(string s)"<<
 	// Skip to "scanIn1" or "scanOut1"
 	tpp++;
 	enum_tokens++;
-cout<<"!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!		ENter the wHiLE LoOP"<<endl;
-cout<<"CuRReNtToKeN:"<<(*tpp)<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!		ENter the wHiLE LoOP");
+TRACE(TRACE_SCAN, TRACE_DEBUG, "CuRReNtToKeN:"<<(*tpp));
 	/**
 	 * For each subsequent string token, delimit it and insert it as a pattern
 	 * vector to the specified signal
@@ -2094,21 +3220,21 @@ cout<<"CuRReNtToKeN:"<<(*tpp)<<endl;
 		 * Note that the first token of this list of strings indicates the name of
 		 * the signal, while the second token indicates the value of that signal
 		 */
-cout<<"$$$$$$$$$$$$$$$$$	Transmit Pattern"<<endl;		
+TRACE(TRACE_SCAN, TRACE_DEBUG, "$$$$$$$$$$$$$$$$$	Transmit Pattern");
 		// Assign this enumerated pattern to the specified pattern
 		transmit_patterns(delimited_pattern);
-cout<<"$$$$$$$$$$$$$$$$$	Pattern Is Transmitted"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "$$$$$$$$$$$$$$$$$	Pattern Is Transmitted");
 		// Move to the next token
 		tpp++;
-cout<<"$$$$$$$$$$$$$$$$$	nExT ToKEn iS:"<< (*tpp) <<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "$$$$$$$$$$$$$$$$$	nExT ToKEn iS:"<< (*tpp) <<"<:::");
 		enum_tokens++;
 	}
-cout<<"~~~~~~~~~~~PRE~~~~~~~~SCAN~~~~~~~~~~~BLOCK~~~~~~~~~~~~TRACE~~~~~~~~~"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "~~~~~~~~~~~PRE~~~~~~~~SCAN~~~~~~~~~~~BLOCK~~~~~~~~~~~~TRACE~~~~~~~~~");
 check_scan_block();	
 	
 	// The signal patterns have been loaded... Process the scan block
 	scan_process();
-cout<<"<<<<<<<<<<<<<<<<<<int file_analyzer::process_scanproc_blk(string s)"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<int file_analyzer::process_scanproc_blk(string s)");
 	return enum_tokens;
 }
 
@@ -2118,7 +3244,8 @@ cout<<"<<<<<<<<<<<<<<<<<<int file_analyzer::process_scanproc_blk(string s)"<<end
  * @return nothing
  */
 void file_analyzer::scan_process() {
-cout<<">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::scan_process() {"<<endl;
+	MEM_SCOPE(MEM_PATTERNS);
+TRACE(TRACE_SCAN, TRACE_DEBUG, ">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::scan_process() {");
 	// Number of tokens traversed by called method
 	int traversed_tokens=0;
 
@@ -2136,23 +3263,26 @@ cout<<">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::scan_process() {"<<
 		cerr<<"Keyword "<<PROCEDURE<<" is not found!"<<endl;
 		throw ViolatedAssertion("Wrong keyword is used.");
 	}
-cout<<"_________SCAN	PROCESS1; token tpp:"<<(*tpp)<<"<:::"<<endl;	
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS1; token tpp:"<<(*tpp)<<"<:::");
 	// Skip past the open bracket: "{"
 	tpp++;
-cout<<"_________SCAN	PROCESS2; token tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS2; token tpp:"<<(*tpp)<<"<:::");
 	// Skip past the keyword "scanProc"
 	tpp++;
-cout<<"_________SCAN	PROCESS3; token tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS3; token tpp:"<<(*tpp)<<"<:::");
 	// Skip another 2 tokens to reach the macros
 	// Skip to "{"
 	tpp++;
-cout<<"_________SCAN	PROCESS4; token tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS4; token tpp:"<<(*tpp)<<"<:::");
 	// Skip to "W"
 	tpp++;
-cout<<"_________SCAN	PROCESS5; token tpp:"<<(*tpp)<<"<:::"<<endl;
-cout<<"_________SCAN	PROCESS6; enter the while loop"<<endl;
-	// While the close bracket is not found...
-	while(!search_key_found(CLOSE_BRACKET, (*tpp))) {
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS5; token tpp:"<<(*tpp)<<"<:::");
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS6; enter the while loop");
+	/**
+	 * While the close bracket is not found, and the last cycle of the slice
+	 * has not been executed...
+	 */
+	while((!search_key_found(CLOSE_BRACKET, (*tpp))) && (!slice_done)) {
 		// Get the delimited string token
 		delimited_pattern = delimit_string(*tpp);
 		// Pointer to tokens in the delimited pattern vector
@@ -2162,47 +3292,50 @@ cout<<"_________SCAN	PROCESS6; enter the while loop"<<endl;
 			// Get the name of the waveform
 			tpp++;
 			// Process this waveform definition
-cout<<"_________SCAN	PROCESS10; found waveform"<<endl;
-cout<<"_________SCAN	PROCESS11; token tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS10; found waveform");
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS11; token tpp:"<<(*tpp)<<"<:::");
 			traversed_tokens=process_waveform_blk(truncate_semicolon(*tpp));
 //******
 traversed_tokens=0;
-cout<<"_________SCAN	PROCESS12; token tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS12; token tpp:"<<(*tpp)<<"<:::");
 		}else if(delimited_pattern.front()==C) {
 			// Process this signal definition
-cout<<"_________SCAN	PROCESS13; found condition"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS13; found condition");
 			traversed_tokens=process_v_blk(tpp, C);
 check_signal_condition();
 check_signal_value();
 //******
-cout<<":::::::::::traversed_tokens:::::::"<<traversed_tokens<<"::::::::::::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, ":::::::::::traversed_tokens:::::::"<<traversed_tokens<<"::::::::::::");
 //traversed_tokens=traversed_tokens*2;
 tpp--;
-cout<<"_________SCAN	PROCESS14; token tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS14; token tpp:"<<(*tpp)<<"<:::");
 		}else if(delimited_pattern.front()==V) {
 			// Process this signal definition
-cout<<"_________SCAN	PROCESS15; found value"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS15; found value");
 			traversed_tokens=process_v_blk(tpp, V);
 check_signal_condition();
 check_signal_value();
-cout<<"_________SCAN	PROCESS16; token tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS16; token tpp:"<<(*tpp)<<"<:::");
 		}else if(delimited_pattern.front()==SHIFT) {
-cout<<"_________SCAN	PROCESS17; found shift"<<endl;
-cout<<"_________SCAN	PROCESS18; token tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS17; found shift");
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS18; token tpp:"<<(*tpp)<<"<:::");
 			// Skip to the signal definition...
 			// Skip to the token "{"
 			tpp++;
-cout<<"_________SCAN	PROCESS19; token tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS19; token tpp:"<<(*tpp)<<"<:::");
 			// Skip to the token "V" representing
 			tpp++;
-cout<<"_________SCAN	PROCESS20; token tpp:"<<(*tpp)<<"<:::"<<endl;
-			// Process this waveform definition
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS20; token tpp:"<<(*tpp)<<"<:::");
+			// Process this waveform definition; its V is charged to the Shift
+			run_stats::scope guard(stats, run_stats::PHASE_SHIFT);
+			in_shift=true;
 			traversed_tokens=process_v_blk(tpp,V);
+			in_shift=false;
 			// Skip to the token "}"
 			tpp++;
-cout<<"_________SCAN	PROCESS21; token tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS21; token tpp:"<<(*tpp)<<"<:::");
 		}
-cout<<"_________SCAN	PROCESS22; pre inner while loop"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS22; pre inner while loop");
 		// Skip past the processed tokens
 		while(traversed_tokens>0) {
 			traversed_tokens--;
@@ -2210,15 +3343,15 @@ cout<<"_________SCAN	PROCESS22; pre inner while loop"<<endl;
 if((*tpp)==SHIFT){
 tpp--;
 }
-cout<<"_________SCAN	PROCESS30; next T:"<<(*tpp)<<"<<::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS30; next T:"<<(*tpp)<<"<<::");
 		}
 
-cout<<"_________SCAN	PROCESS; last part of while loop-token tpp:"<<(*tpp)<<"<:::"<<endl;		
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS; last part of while loop-token tpp:"<<(*tpp)<<"<:::");
 		// Proceed to the next token
 		tpp++;
-cout<<"_________SCAN	PROCESS; last part of while loop-incre tpp:"<<(*tpp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "_________SCAN	PROCESS; last part of while loop-incre tpp:"<<(*tpp)<<"<:::");
 	}
-cout<<"<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::scan_process() {"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::scan_process() {");
 }
 
 
@@ -2234,7 +3367,8 @@ cout<<"<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::scan_process() {"<<
  * @return nothing
  */
 void file_analyzer::transmit_patterns(str_list signame_n_pattern) {
-cout<<">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::transmit_patterns()"<<endl;
+	MEM_SCOPE(MEM_PATTERNS);
+TRACE(TRACE_SCAN, TRACE_DEBUG, ">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::transmit_patterns()");
 /*
 Search for signal name, update pattern, and exit
 */
@@ -2268,14 +3402,14 @@ Search for signal name, update pattern, and exit
 	sig_l_p pat_p=list_of_ip_signals.begin();
 	// Enumerate each input signal to search for indicated signal
 	while(pat_p != list_of_ip_signals.end()) {
-cout<<"ii$$$$$$$$$$$$$$$$$	Currently enumerating signal with name:"<<(*pat_p)->get_name()<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "ii$$$$$$$$$$$$$$$$$	Currently enumerating signal with name:"<<(*pat_p)->get_name());
 		// Is this currently enumerated signal equal to the indicated signal?
 		if((*snp) == (*pat_p)->get_name()) {
 			// Yes... Get its pattern
 			snp++;
 			// Add the signal pattern to this signal
 			(*pat_p)->add_sig_patterns(*snp);
-cout<<"ip SigPaTtERn:"<<(*snp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "ip SigPaTtERn:"<<(*snp)<<"<:::");
 			// Exit function... since no other function should be affected
 			return;
 		}
@@ -2292,14 +3426,14 @@ cout<<"ip SigPaTtERn:"<<(*snp)<<"<:::"<<endl;
 	pat_p=list_of_op_signals.begin();
 	// Enumerate each output signal to search for indicated signal
 	while(pat_p != list_of_op_signals.end()) {
-cout<<"oo$$$$$$$$$$$$$$$$$	Currently enumerating signal with name:"<<(*pat_p)->get_name()<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "oo$$$$$$$$$$$$$$$$$	Currently enumerating signal with name:"<<(*pat_p)->get_name());
 		// Is this currently enumerated signal equal to the indicated signal?
 		if((*snp) == (*pat_p)->get_name()) {
 			// Yes... Get its pattern
 			snp++;
 			// Add the signal pattern to this signal
 			(*pat_p)->add_sig_patterns(*snp);
-cout<<"op SigPaTtERn:"<<(*snp)<<"<:::"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "op SigPaTtERn:"<<(*snp)<<"<:::");
 			// Exit function... since no other function should be affected
 			return;
 		}
@@ -2310,7 +3444,7 @@ cout<<"op SigPaTtERn:"<<(*snp)<<"<:::"<<endl;
 	
 	// Specified signal is not found...
 	throw ViolatedPrecondition("Specified signal is not found!!!");
-cout<<"<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::transmit_patterns()"<<endl;
+TRACE(TRACE_SCAN, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::transmit_patterns()");
 }
 
 
@@ -2324,7 +3458,7 @@ cout<<"<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::transmit_patterns()"<
  * @return nothing
  */
 void file_analyzer::update_indv_sig(string sig_name, string sig_val, string sig_type) {
-cout<<">>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::update_indv_sig(string sig_name, string sig_val, string sig_type)"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, ">>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::update_indv_sig(string sig_name, string sig_val, string sig_type)");
 	// Search for the signal
 	
 	
@@ -2339,9 +3473,9 @@ cout<<">>>>>>>>>>>>>>>>>>>>>>>void file_analyzer::update_indv_sig(string sig_nam
 			// Yes... Check if indicator is a condition
 			if(sig_type == C) {
 				// Set the condition of the signal
-cout<<"Set the condition of this signal"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Set the condition of this signal");
 				(*slp)->set_condition(sig_val);
-cout<<"Condition of this signal"<<(*slp)->get_condition()<<"<:::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Condition of this signal"<<(*slp)->get_condition()<<"<:::");
 			}else if(sig_type == V) {
 				/**
 				 * Or a signal vector...
@@ -2360,10 +3494,10 @@ cout<<"Condition of this signal"<<(*slp)->get_condition()<<"<:::"<<endl;
 					 */
 //### IMPORTANT
 //					(*slp)->add_values((*slp)->get_last_pattern());
-cout<<"PPP\tSet the pattern to be:"<<(*slp)->get_last_pattern()<<"<:::"<<endl;
-cout<<"PPP\tCurVal:"<<(*slp)->get_sig_values()<<"<:::"<<endl;
+					// The legacy trace popped a pattern; keep it popped
+					string popped=(*slp)->get_last_pattern();
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "PPP\tSet the pattern to be:"<<popped<<"<:::");
 					(*slp)->sig_vector((*slp)->get_last_pattern());
-cout<<"PPP\tNEW CurVal:"<<(*slp)->get_sig_values()<<"<:::"<<endl;
 //				}else if((*slp)->condition_met()) {
 				}else{
 					/**
@@ -2373,17 +3507,15 @@ cout<<"PPP\tNEW CurVal:"<<(*slp)->get_sig_values()<<"<:::"<<endl;
 					 */
 //### IMPORTANT
 //					(*slp)->add_values(sig_val);
-cout<<"The condition is:"<<(*slp)->get_condition()<<":COND"<<endl;
-cout<<"Set the pattern to be:"<<sig_val<<"<:::"<<endl;
-cout<<"CurVal:"<<(*slp)->get_sig_values()<<"<:::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "The condition is:"<<(*slp)->get_condition()<<":COND");
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Set the pattern to be:"<<sig_val<<"<:::");
 					(*slp)->sig_vector(sig_val);
-cout<<"NEW CurVal:"<<(*slp)->get_sig_values()<<"<:::"<<endl;
 				}
 			}else{
 				// Report this error
 				throw ViolatedAssertion("Type of signal indicator is invalid");
 			}
-cout<<"<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::update_indv_sig(string sig_name, string sig_val, string sig_type)"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::update_indv_sig(string sig_name, string sig_val, string sig_type)");
 			// End of method
 			return;
 		}
@@ -2395,7 +3527,7 @@ cout<<"<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::update_indv_sig(string sig_nam
 	// Else, is this signal an output signal?
 	// Use a pointer to access the first output signal
 	slp = list_of_op_signals.begin();
-cout<<"Look at the output signals for the system"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Look at the output signals for the system");
 	// While there are more output signals to process...
 	while(slp != list_of_op_signals.end()) {
 		// Does this output signal matches with the desired output signal
@@ -2403,9 +3535,9 @@ cout<<"Look at the output signals for the system"<<endl;
 			// Yes... Check if indicator is a condition
 			if(sig_type == C) {
 				// Set the condition of the signal
-cout<<"Condition is:"<<(*slp)->get_condition()<<":Updated to:"<<sig_val<<"<:::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Condition is:"<<(*slp)->get_condition()<<":Updated to:"<<sig_val<<"<:::");
 				(*slp)->set_condition(sig_val);
-cout<<"Condition is NOW:"<<(*slp)->get_condition()<<"<:::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "Condition is NOW:"<<(*slp)->get_condition()<<"<:::");
 			}else if(sig_type == V) {
 				/**
 				 * Or a signal vector...
@@ -2426,23 +3558,23 @@ cout<<"Condition is NOW:"<<(*slp)->get_condition()<<"<:::"<<endl;
 					 */
 //### IMPORTANT
 //					(*slp)->add_values((*slp)->get_last_pattern());
-cout<<"pattern IS:"<<(*slp)->get_last_pattern()<<"<::"<<endl;
+					// The legacy trace popped a pattern; keep it popped
+					string popped=(*slp)->get_last_pattern();
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "pattern IS:"<<popped<<"<::");
 					(*slp)->sig_vector((*slp)->get_last_pattern());
-cout<<"pattern IS upDaTEd tO:"<<(*slp)->get_sig_values()<<"<::"<<endl;
 //				}else if((*slp)->condition_met()) {
 				}else{
 					// Else, is the condition met
 //### IMPORTANT
 //					(*slp)->add_values(sig_val);
-cout<<"SigValPattern is:"<<sig_val<<":::"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "SigValPattern is:"<<sig_val<<":::");
 					(*slp)->sig_vector(sig_val);
-cout<<"SigValPattern is NOw updated TO:"<<(*slp)->get_sig_values()<<":::"<<endl;
 				}
 			}else{
 				// Report this error
 				throw ViolatedAssertion("Invalid type of signal indicator");
 			}
-cout<<"<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::update_indv_sig(string sig_name, string sig_val, string sig_type)"<<endl;
+TRACE(TRACE_PATTERN, TRACE_DEBUG, "<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::update_indv_sig(string sig_name, string sig_val, string sig_type)");
 			// End of method
 			return;
 		}
@@ -2463,7 +3595,11 @@ cout<<"<<<<<<<<<<<<<<<<<<<<<<<void file_analyzer::update_indv_sig(string sig_nam
  * @return nothing
  */
 void file_analyzer::check_waveform() {
-cout<<"w\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\"<<endl;
+	// Nothing is printed unless the checks are traced
+	if(!TRACE_ENABLED(TRACE_CHECK, TRACE_DEBUG)) {
+		return;
+	}
+TRACE(TRACE_CHECK, TRACE_DEBUG, "w\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\");
 	// List of waveform properties for a signal
 	signalZ::wp_list sl;
 	// Pointer to the list of waveform properties for a signal
@@ -2475,17 +3611,22 @@ cout<<"w\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
 		// Indicate its waveform properties
 		sl = (*sp)->get_wave_prop();
 		wp=sl.begin();
-		cout<<"For signal:"<<(*sp)->get_name();
+		ostringstream trace_line;
+		trace_line<<"For signal:"<<(*sp)->get_name();
 		// Enumerate each signal waveform property...
 		while(wp != sl.end()) {
 			// Print the information in this waveform property
-			cout<<":time:"<<(*wp).time;
-			cout<<":logic value:"<<(*wp).logic_val;
+			trace_line<<":time:"<<(*wp).time<<"ps";
+			trace_line<<":logic value:";
+			for(int e=0; e<(*wp).num_events; e++) {
+				trace_line<<signalZ::event_char((*wp).events[e]);
+			}
 			
 			// Move to the next waveform property...
 			wp++;
 		}
-		cout<<"<:::"<<endl;
+		trace_line<<"<:::";
+		trace::write(trace_line.str());
 		
 		// Proceed to the next available signal
 		sp++;
@@ -2499,22 +3640,27 @@ cout<<"w\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
 		// Indicate its waveform properties
 		sl = (*sp)->get_wave_prop();
 		wp=sl.begin();
-		cout<<"For signal:"<<(*sp)->get_name();
+		ostringstream trace_line;
+		trace_line<<"For signal:"<<(*sp)->get_name();
 		// Enumerate each signal waveform property...
 		while(wp != sl.end()) {
 			// Print the information in this waveform property
-			cout<<":time:"<<(*wp).time;
-			cout<<":logic value:"<<(*wp).logic_val;
+			trace_line<<":time:"<<(*wp).time<<"ps";
+			trace_line<<":logic value:";
+			for(int e=0; e<(*wp).num_events; e++) {
+				trace_line<<signalZ::event_char((*wp).events[e]);
+			}
 			
 			// Move to the next waveform property...
 			wp++;
 		}
-		cout<<"<:::"<<endl;
+		trace_line<<"<:::";
+		trace::write(trace_line.str());
 		
 		// Proceed to the next available signal
 		sp++;
 	}
-cout<<"w///////////////////////////////////////////////////////////////////"<<endl;
+TRACE(TRACE_CHECK, TRACE_DEBUG, "w///////////////////////////////////////////////////////////////////");
 }
 
 
@@ -2524,14 +3670,20 @@ cout<<"w///////////////////////////////////////////////////////////////////"<<en
  * @return nothing
  */
 void file_analyzer::check_signal_condition() {
-cout<<"c\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\"<<endl;
+	// Nothing is printed unless the checks are traced
+	if(!TRACE_ENABLED(TRACE_CHECK, TRACE_DEBUG)) {
+		return;
+	}
+TRACE(TRACE_CHECK, TRACE_DEBUG, "c\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\");
 	// Pointer to the first element in the list of input signals
 	sig_l_p sp = list_of_ip_signals.begin();
 	// For each input signal...
 	while(sp != list_of_ip_signals.end()) {
 		// Print the signal's current condition...
-		cout<<"For signal:"<<(*sp)->get_name()<<":condition:";
-		cout<<(*sp)->get_condition()<<"<:::"<<endl;
+		ostringstream trace_line;
+		trace_line<<"For signal:"<<(*sp)->get_name()<<":condition:";
+		trace_line<<(*sp)->get_condition()<<"<:::";
+		trace::write(trace_line.str());
 		// Proceed to the next available signal
 		sp++;
 	}
@@ -2541,12 +3693,14 @@ cout<<"c\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
 	// For each output signal...
 	while(sp != list_of_op_signals.end()) {
 		// Print the signal's current condition...
-		cout<<"For signal:"<<(*sp)->get_name()<<":condition:";
-		cout<<(*sp)->get_condition()<<"<:::"<<endl;
+		ostringstream trace_line;
+		trace_line<<"For signal:"<<(*sp)->get_name()<<":condition:";
+		trace_line<<(*sp)->get_condition()<<"<:::";
+		trace::write(trace_line.str());
 		// Proceed to the next available signal
 		sp++;
 	}
-cout<<"c///////////////////////////////////////////////////////////////////"<<endl;
+TRACE(TRACE_CHECK, TRACE_DEBUG, "c///////////////////////////////////////////////////////////////////");
 }
 
 
@@ -2555,14 +3709,24 @@ cout<<"c///////////////////////////////////////////////////////////////////"<<en
  * @return nothing
  */
 void file_analyzer::check_signal_value() {
-cout<<"v\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\"<<endl;
+	// Nothing is printed unless the checks are traced
+	if(!TRACE_ENABLED(TRACE_CHECK, TRACE_DEBUG)) {
+		return;
+	}
+TRACE(TRACE_CHECK, TRACE_DEBUG, "v\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\");
+	// The values are being expanded by the pipeline; waiting would stall it
+	if(pipeline != NULL) {
+		return;
+	}
 	// Pointer to the first element in the list of input signals
 	sig_l_p sp = list_of_ip_signals.begin();
 	// For each input signal...
 	while(sp != list_of_ip_signals.end()) {
 		// Print the signal's current condition...
-		cout<<"For signal:"<<(*sp)->get_name()<<":value:";
-		cout<<(*sp)->get_sig_values()<<"<:::"<<endl;
+		ostringstream trace_line;
+		trace_line<<"For signal:"<<(*sp)->get_name()<<":value:";
+		trace_line<<(*sp)->get_sig_values()<<"<:::";
+		trace::write(trace_line.str());
 		// Proceed to the next available signal
 		sp++;
 	}
@@ -2572,12 +3736,14 @@ cout<<"v\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
 	// For each output signal...
 	while(sp != list_of_op_signals.end()) {
 		// Print the signal's current condition...
-		cout<<"For signal:"<<(*sp)->get_name()<<":value:";
-		cout<<(*sp)->get_sig_values()<<"<:::"<<endl;
+		ostringstream trace_line;
+		trace_line<<"For signal:"<<(*sp)->get_name()<<":value:";
+		trace_line<<(*sp)->get_sig_values()<<"<:::";
+		trace::write(trace_line.str());
 		// Proceed to the next available signal
 		sp++;
 	}
-cout<<"v///////////////////////////////////////////////////////////////////"<<endl;
+TRACE(TRACE_CHECK, TRACE_DEBUG, "v///////////////////////////////////////////////////////////////////");
 }
 
 
@@ -2588,7 +3754,11 @@ cout<<"v///////////////////////////////////////////////////////////////////"<<en
  * @return nothing
  */
 void file_analyzer::check_scan_block() {
-cout<<"sb\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\"<<endl;
+	// Nothing is printed unless the checks are traced
+	if(!TRACE_ENABLED(TRACE_CHECK, TRACE_DEBUG)) {
+		return;
+	}
+TRACE(TRACE_CHECK, TRACE_DEBUG, "sb\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\");
 	// Pointer to currently enumerated string/signal pattern
 	str_l_p sp_p;
 	// List of signal patterns for this signal
@@ -2600,7 +3770,8 @@ cout<<"sb\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
 	// For each input signal...
 	while(sp != list_of_ip_signals.end()) {
 		// Print the signal's list of patterns...
-		cout<<"Name of Signal<<<"<<(*sp)->get_name()<<"<<<";
+		ostringstream trace_line;
+		trace_line<<"Name of Signal<<<"<<(*sp)->get_name()<<"<<<";
 
 		// Does it have any input signals?
 		if((*sp)->get_num_patterns() > 0) {
@@ -2609,14 +3780,14 @@ cout<<"sb\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
 			sp_p = list_pat.begin();
 			while(sp_p != list_pat.end()) {
 				// Print this currently enumerated pattern
-				cout << "Pattern::<>::" << (*sp_p) << "::><::";
+				trace_line<<"Pattern::<>::" << (*sp_p) << "::><::";
 				
 				// Access the next available pattern...
 				sp_p++;
 			}
 		}
 		
-		cout << "" << endl;
+		trace::write(trace_line.str());
 		
 		// Proceed to the next available signal
 		sp++;
@@ -2627,7 +3798,8 @@ cout<<"sb\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
 	// For each output signal...
 	while(sp != list_of_op_signals.end()) {
 		// Print the signal's list of patterns...
-		cout<<"Name of Signal<<<"<<(*sp)->get_name()<<"<<<";
+		ostringstream trace_line;
+		trace_line<<"Name of Signal<<<"<<(*sp)->get_name()<<"<<<";
 		// Does it have any input signals?
 
 		// Does it have any input signals?
@@ -2637,20 +3809,20 @@ cout<<"sb\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
 			sp_p = list_pat.begin();
 			while(sp_p != list_pat.end()) {
 				// Print this currently enumerated pattern
-				cout << "Pattern::<>::" << (*sp_p) << "::><::";
+				trace_line<<"Pattern::<>::" << (*sp_p) << "::><::";
 				
 				// Access the next available pattern...
 				sp_p++;
 			}
-			cout<<"End of currently processed block"<<endl;
+			trace_line<<"End of currently processed block";
 		}
 		
-		cout << "" << endl;
+		trace::write(trace_line.str());
 		
 		// Proceed to the next available signal
 		sp++;
 	}
-cout<<"sb///////////////////////////////////////////////////////////////////"<<endl;
+TRACE(TRACE_CHECK, TRACE_DEBUG, "sb///////////////////////////////////////////////////////////////////");
 	
 }
 
@@ -2658,11 +3830,11 @@ cout<<"sb///////////////////////////////////////////////////////////////////"<<e
 
 /**
  * Function to pass the period of the dominant clock into all signals
- * @param period_of_sig is the period of the dominant clock
+ * @param period_of_sig is the period of the dominant clock in picoseconds
  * @return nothing
  */
-void file_analyzer::update_sig_period(int period_of_sig) {
-cout<<"Set the clock periods for input signals"<<endl;
+void file_analyzer::update_sig_period(int64_t period_of_sig) {
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Set the clock periods for input signals");
 	// Pointer to signals in the input list
 	sig_l_p sgp = list_of_ip_signals.begin();
 	// For each input signal
@@ -2670,14 +3842,13 @@ cout<<"Set the clock periods for input signals"<<endl;
 		// Update the period of this signal
 		(*sgp)->set_sig_period(period_of_sig);
 		
-cout<<"InpUTSignalNaME;"<<(*sgp)->get_name();
-cout<<"; iPSiGNaLPerIoD;"<<(*sgp)->get_sig_period()<<"<;;;"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "InpUTSignalNaME;"<<(*sgp)->get_name() << "; iPSiGNaLPerIoD;"<<(*sgp)->get_sig_period()<<"<;;;");
 		
 		// Proceed to the next available signal
 		sgp++;
 	}
 	
-cout<<"Set the clock periods for output signals"<<endl;	
+TRACE(TRACE_TIMING, TRACE_DEBUG, "Set the clock periods for output signals");
 	// Pointer to signals in the output list
 	sgp = list_of_op_signals.begin();
 	// For each output signal
@@ -2685,12 +3856,11 @@ cout<<"Set the clock periods for output signals"<<endl;
 		// Update the period of this signal
 		(*sgp)->set_sig_period(period_of_sig);
 		
-cout<<"OuTpUTSignalNaME;"<<(*sgp)->get_name();
-cout<<"; OPSiGNaLPerIoD;"<<(*sgp)->get_sig_period()<<"<;;;"<<endl;		
+TRACE(TRACE_TIMING, TRACE_DEBUG, "OuTpUTSignalNaME;"<<(*sgp)->get_name() << "; OPSiGNaLPerIoD;"<<(*sgp)->get_sig_period()<<"<;;;");
 		// Proceed to the next available signal
 		sgp++;
 	}
-cout<<"The clock periods for input and output signals are set"<<endl;
+TRACE(TRACE_TIMING, TRACE_DEBUG, "The clock periods for input and output signals are set");
 }
 
 
@@ -19,9 +19,17 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <list>
+#include <vector>
 #include <iterator>
+#include <functional>
 
+#include "compiled_stil.h"
 #include "signalZ.h"
+#include "output_buffer.h"
+#include "table_index.h"
+#include "thread_pool.h"
+#include "pattern_pipeline.h"
+#include "run_stats.h"
 
 #ifndef __FILE_ANALYZER_H
 #define __FILE_ANALYZER_H
@@ -31,8 +39,8 @@ using namespace std;
 
 // List of strings
 typedef list<string> str_list;
-// Pointer to list of strings
-typedef list<string>::iterator str_l_p;
+// Pointer to list of strings; the tokens of a compiled file are read-only
+typedef list<string>::const_iterator str_l_p;
 
 // List of signalZs
 typedef list<signalZ *> sig_list;
@@ -48,16 +56,22 @@ class file_analyzer {
 		string in_file;
 		// Name of output file
 		string out_file;
-		// Input stream for the appropriate input filename
-		ifstream inputfile;
-		// Output stream for the appropriate output filename
-		ofstream outputfile;
+		// Buffered output for the appropriate output filename
+		output_buffer outputfile;
+		/**
+		 * Compiled input file, which this run only reads; it is owned by
+		 * this run, unless it is shared with other runs
+		 */
+		compiled_stil *own_compiled;
+		const compiled_stil *compiled;
 		// List of strings tokens found in the input file
-		str_list list_tokens;
+		const str_list &list_tokens;
 		// Stack for temporary storage of parentheses in processing blocks
 		str_list list_blocks;
-		// Duration of the period for the selected clock (using UNIT_OF_TIME)
-		int period_t;
+		// Quantization unit of time of this run, in nanoseconds
+		int measure_of_time;
+		// Duration of the period for the selected clock in picoseconds
+		int64_t period_t;
 		// List of input signals in the test pattern or output file
 		sig_list list_of_ip_signals;
 		// List of output signals in the test pattern or output file
@@ -66,6 +80,68 @@ class file_analyzer {
 		signalZ *temp_sig;
 		// List of string pattern to be substituted in the scanproc defintion
 		str_list str_patterns;
+		/**
+		 * Is each cycle written to the output file as soon as it has been
+		 * expanded?
+		 */
+		bool streaming;
+		// Number of cycles (V vectors) that have been executed
+		long long num_cycles;
+		/**
+		 * Format of the output file; FORMAT_TABLE, FORMAT_BINARY, FORMAT_VCD
+		 * or FORMAT_VECTOR
+		 */
+		int output_format;
+		// Test date from the Header block
+		string test_date;
+		// Names and periods (in picoseconds) of the compiled WaveformTables
+		vector<string> wft_names;
+		vector<int64_t> wft_periods;
+		/**
+		 * Cycle index: the number of values of each signal (inputs, then
+		 * outputs) at the start of every index_stride cycles
+		 */
+		bool record_index;
+		int index_stride;
+		vector<uint64_t> cycle_index;
+		// Is the sidecar index of the table written?
+		bool write_table_index;
+		// Number of threads that expand the signals and write the output file
+		int num_threads;
+		// Pool of num_threads threads; created when it is first used
+		thread_pool *pool;
+		// Is the expansion of the signals deferred, to run in parallel?
+		bool deferring;
+		// Names, groups or glob patterns of the selected signals; all if empty
+		vector<string> selection;
+		/**
+		 * Slice of the pattern that is written: cycles [first_cycle,
+		 * last_cycle); last_cycle is negative for the end of the pattern
+		 */
+		long long first_cycle;
+		long long last_cycle;
+		// Has the last cycle of the slice been executed?
+		bool slice_done;
+		/**
+		 * Do the lexing, the expansion and the output run as stages of a
+		 * pipeline, each on its own thread? The pipeline of the expansion
+		 * and the output, whilst the pattern is executed
+		 */
+		bool pipelined;
+		pattern_pipeline *pipeline;
+		/**
+		 * Function that each cycle of the slice is handed to, with the
+		 * values of each selected signal in that cycle, instead of writing
+		 * them to the output file; the values of the current cycle
+		 */
+		function<void(long long, vector<string> &)> cycle_sink;
+		vector<string> cycle_values;
+		/**
+		 * Timings and counters of the phases of this run; NULL if they are
+		 * not measured. Is a V executed by a Shift block?
+		 */
+		run_stats *stats;
+		bool in_shift;
 
 
 		// --------------------------------------------------------------
@@ -73,8 +149,20 @@ class file_analyzer {
 
 	public:
 		// Initialize constants...
-		// Quantization unit of time that is measured in nanoseconds
-		static const int file_analyzer::MEASURE_OF_TIME = 5;
+		// Default quantization unit of time that is measured in nanoseconds
+		static const int MEASURE_OF_TIME = 5;
+		// Default quantization unit of time that is measured in picoseconds
+		static const int64_t MEASURE_OF_TIME_PS =
+			MEASURE_OF_TIME * signalZ::PS_PER_UNIT_OF_TIME;
+		// Formats of the output file
+		static const int FORMAT_TABLE = 0;
+		static const int FORMAT_BINARY = 1;
+		static const int FORMAT_VCD = 2;
+		static const int FORMAT_VECTOR = 3;
+		// Default number of cycles between checkpoints of the cycle index
+		static const int DEFAULT_INDEX_STRIDE = 64;
+		// Number of cycles whose signals are expanded together, in parallel
+		static const int EXPANSION_BATCH = 1024;
 		/**
 		 * Flag to indicate that the index of this character in a string
 		 * is invalid
@@ -123,6 +211,14 @@ class file_analyzer {
 		
 		// Standard Constructor...
 		file_analyzer(string input_filename, string output_filename);
+		/**
+		 * Constructor of a run of a compiled file, which may be shared by
+		 * other runs at the same time; without an output file if its name
+		 * is empty
+		 */
+		file_analyzer(const compiled_stil &stil, string output_filename);
+		// Destructor; deletes the signals
+		~file_analyzer();
 		
 		// =========================================================
 		
@@ -135,6 +231,7 @@ class file_analyzer {
 		void process_header();
 		// To be completed
 		void process_pattern_blk();
+		void execute_pattern(str_l_p ptn);
 		// To be completed
 		void process_macro_blk(string macro_name);
 		// To be completed
@@ -157,6 +254,56 @@ class file_analyzer {
 		void print_output_ln(string current_ln);
 		void close_io_streams();
 		void dump_output();
+		// Bypass the page cache when the output file is written
+		bool set_direct_io(bool enable);
+		// Drop written pages of the output file from the page cache
+		void set_fadvise(bool enable);
+		// Write a row of all signals for each cycle, as it is executed
+		void set_streaming(bool enable);
+		void begin_cycle_output();
+		void end_of_cycle();
+		// Select the format of the output file
+		void set_output_format(int format);
+		// Set the number of cycles between checkpoints of the cycle index
+		void set_index_stride(int stride);
+		void record_checkpoint();
+		void record_wft(string name, int64_t period);
+		void dump_binary_output();
+		void dump_vcd_output();
+		void dump_vector_output();
+		// Write the sidecar index of the table, next to the output file
+		void set_table_index(bool enable);
+		void add_index_row(table_index &ti, signalZ *s, uint64_t row_offset);
+		// Select the signals that are expanded, stored and written
+		void set_selection(string spec);
+		bool selects(string entry, signalZ *s, bool is_input);
+		void apply_selection();
+		// Set the number of threads that expand and write the signals
+		void set_num_threads(int n);
+		thread_pool &get_pool();
+		void dump_output_parallel();
+		// Expand the queued values of all signals, in parallel
+		void set_deferred(bool d);
+		void expand_signals();
+		// Write only a slice of the cycles of the pattern
+		void set_cycle_range(long long first, long long last);
+		void set_fast_forward(bool f);
+		long long num_slice_cycles();
+		// Run the lexing, the expansion and the output on their own threads
+		void set_pipelined(bool enable);
+		void start_pipeline();
+		void stop_pipeline();
+		// Hand each cycle to a function, instead of writing an output file
+		void set_cycle_sink(function<void(long long, vector<string> &)> sink);
+		void get_selected_signals(vector<string> &names, vector<bool> &inputs);
+		// Names and periods of the WaveformTables that have been compiled
+		void get_wfts(vector<string> &names, vector<int64_t> &periods);
+		// Measure the phases of this run into the statistics; NULL for none
+		void set_stats(run_stats *s);
+		void count_stats();
+		// Set the quantization unit of time of this run, in nanoseconds
+		void set_measure_of_time(int ns);
+		int get_measure_of_time();
 		
 		
 		// Functions for string manipulation/operation
@@ -168,12 +315,13 @@ string time_to_string(int duration, int logic_value);
 		string truncate_semicolon(string s);
 		str_list delimit_string(string delimit_str);
 		string chop_ns(string clk_time);
+		int64_t parse_time(string t);
 		string truncate_whitespace(string s);
 		
 		
 		// Functions for inter-class communication
 		void transmit_patterns(str_list signame_n_pattern);
-		void update_sig_period(int period_of_sig);
+		void update_sig_period(int64_t period_of_sig);
 		
 		
 		// Functions for functional verification
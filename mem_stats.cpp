@@ -0,0 +1,323 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Accounting of the allocations of the heap; see mem_stats.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #Each block of operator new is preceded by a header of HEADER_SIZE bytes,
+ *	which holds its size and its site, so that it is given back to the site
+ *	that allocated it, on whichever thread it is freed. HEADER_SIZE keeps
+ *	the alignment of malloc(). Allocations with an extended alignment are
+ *	left to the aligned operator new of the library, and are not counted.
+ * #The first NUM_MEM_SUBSYSTEMS sites are those of the subsystems: the site
+ *	of MEM_OTHER takes the allocations outside every scope, and the site of
+ *	every other subsystem takes its memory of MEM_EXTERNAL()
+ * #Sizes are those requested, not those that malloc() rounds them up to
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <new>
+#include <stdlib.h>
+
+#include "mem_stats.h"
+
+using namespace std;
+
+// Initialize class variables...
+thread_local int mem_stats::current_site=MEM_OTHER;
+atomic<int> mem_stats::num_sites(NUM_MEM_SUBSYSTEMS);
+mem_stats::site_info mem_stats::sites[MAX_SITES];
+mem_stats::counters mem_stats::site_counters[MAX_SITES];
+mem_stats::counters mem_stats::subsystem_counters[NUM_MEM_SUBSYSTEMS];
+atomic<int64_t> mem_stats::total_live(0);
+atomic<int64_t> mem_stats::total_peak(0);
+
+
+#ifdef STIL_MEMSTATS
+// Size of the header before each block; see IMPORTANT ASSUMPTIONS
+static const size_t HEADER_SIZE = 16;
+
+// Header before each block of operator new
+struct mem_header {
+	uint64_t size;
+	int64_t site;
+};
+
+
+/**
+ * Function to allocate a block, after its header, and charge it to the site
+ * of this thread
+ * @param n is the size of the block
+ * @return the block; NULL if it cannot be allocated
+ */
+static void *allocate_block(size_t n) {
+	mem_header *h=(mem_header *)malloc(n+HEADER_SIZE);
+	if(h == NULL) {
+		return NULL;
+	}
+	h->size=n;
+	h->site=mem_stats::get_current_site();
+	mem_stats::allocated(h->site, n);
+	return (char *)h+HEADER_SIZE;
+}
+
+
+// Function to free a block of allocate_block(), and give it back to its site
+static void free_block(void *p) {
+	if(p == NULL) {
+		return;
+	}
+	mem_header *h=(mem_header *)((char *)p-HEADER_SIZE);
+	mem_stats::freed(h->site, h->size);
+	free(h);
+}
+
+
+// Replacements of the global operator new and delete
+void *operator new(size_t n) {
+	void *p=allocate_block(n);
+	if(p == NULL) {
+		throw bad_alloc();
+	}
+	return p;
+}
+
+void *operator new[](size_t n) {
+	return operator new(n);
+}
+
+void *operator new(size_t n, const nothrow_t &) noexcept {
+	return allocate_block(n);
+}
+
+void *operator new[](size_t n, const nothrow_t &) noexcept {
+	return allocate_block(n);
+}
+
+void operator delete(void *p) noexcept {
+	free_block(p);
+}
+
+void operator delete[](void *p) noexcept {
+	free_block(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+	free_block(p);
+}
+
+void operator delete[](void *p, size_t) noexcept {
+	free_block(p);
+}
+
+void operator delete(void *p, const nothrow_t &) noexcept {
+	free_block(p);
+}
+
+void operator delete[](void *p, const nothrow_t &) noexcept {
+	free_block(p);
+}
+#endif
+
+
+// Function to format bytes as kilobytes
+static string to_kb(int64_t bytes) {
+	ostringstream s;
+	s << fixed << setprecision(1) << (bytes/1024.0);
+	return s.str();
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to register a site of a subsystem
+ * @param subsystem is the subsystem that the allocations of the site are
+ *	charged to
+ * @param file is the source file of the site
+ * @param line is its line
+ * @param function is its function
+ * @return the site; the site of MEM_OTHER if there are MAX_SITES sites
+ */
+int mem_stats::register_site(mem_subsystem subsystem, const char *file,
+	int line, const char *function) {
+
+	int site=num_sites.fetch_add(1);
+	if(site >= MAX_SITES) {
+		num_sites.store(MAX_SITES);
+		return MEM_OTHER;
+	}
+	sites[site].file=file;
+	sites[site].line=line;
+	sites[site].function=function;
+	sites[site].subsystem=subsystem;
+	return site;
+}
+
+
+// Function to get the site of the allocations of this thread
+int mem_stats::get_current_site() {
+	return current_site;
+}
+
+
+/**
+ * Function to add n bytes to live bytes, and raise their high-water mark
+ * @param live is the live bytes
+ * @param peak is their high-water mark
+ * @param n is the number of bytes; negative if they are freed
+ * @return nothing
+ */
+void mem_stats::add_live(atomic<int64_t> &live, atomic<int64_t> &peak,
+	int64_t n) {
+
+	int64_t now=live.fetch_add(n, memory_order_relaxed)+n;
+	int64_t high=peak.load(memory_order_relaxed);
+	while((now > high)
+		&& !peak.compare_exchange_weak(high, now, memory_order_relaxed)) {
+
+	}
+}
+
+
+/**
+ * Function to charge n bytes that are allocated to a site, and to its
+ * subsystem
+ * @param site is the site
+ * @param n is the number of bytes
+ * @return nothing
+ */
+void mem_stats::allocated(int site, uint64_t n) {
+	int s=(site < NUM_MEM_SUBSYSTEMS) ? site : sites[site].subsystem;
+	site_counters[site].allocs.fetch_add(1, memory_order_relaxed);
+	site_counters[site].bytes.fetch_add(n, memory_order_relaxed);
+	add_live(site_counters[site].live, site_counters[site].peak, n);
+	subsystem_counters[s].allocs.fetch_add(1, memory_order_relaxed);
+	subsystem_counters[s].bytes.fetch_add(n, memory_order_relaxed);
+	add_live(subsystem_counters[s].live, subsystem_counters[s].peak, n);
+	add_live(total_live, total_peak, n);
+}
+
+
+/**
+ * Function to give n bytes that are freed back to the site that they were
+ * charged to
+ * @param site is the site
+ * @param n is the number of bytes
+ * @return nothing
+ */
+void mem_stats::freed(int site, uint64_t n) {
+	int s=(site < NUM_MEM_SUBSYSTEMS) ? site : sites[site].subsystem;
+	site_counters[site].frees.fetch_add(1, memory_order_relaxed);
+	site_counters[site].live.fetch_sub(n, memory_order_relaxed);
+	subsystem_counters[s].frees.fetch_add(1, memory_order_relaxed);
+	subsystem_counters[s].live.fetch_sub(n, memory_order_relaxed);
+	total_live.fetch_sub(n, memory_order_relaxed);
+}
+
+
+// Function to determine if the accounting is compiled in
+bool mem_stats::is_compiled_in() {
+#ifdef STIL_MEMSTATS
+	return true;
+#else
+	return false;
+#endif
+}
+
+
+/**
+ * Function to report the allocations of each subsystem as a table
+ * @return the lines of the table
+ */
+string mem_stats::get_table() {
+	ostringstream s;
+	s << left << setw(10) << "memory" << right << setw(12) << "allocs"
+		<< setw(12) << "frees" << setw(14) << "KB allocated"
+		<< setw(12) << "KB live" << setw(12) << "KB peak" << endl;
+	for(int m=0; m<NUM_MEM_SUBSYSTEMS; m++) {
+		counters &c=subsystem_counters[m];
+		s << left << setw(10) << get_subsystem_name(m) << right
+			<< setw(12) << c.allocs.load() << setw(12) << c.frees.load()
+			<< setw(14) << to_kb(c.bytes.load()) << setw(12)
+			<< to_kb(c.live.load()) << setw(12) << to_kb(c.peak.load())
+			<< endl;
+	}
+	s << "Peak of the heap (KB): " << to_kb(total_peak.load()) << endl;
+	return s.str();
+}
+
+
+/**
+ * Function to report the allocations of each subsystem as the members of a
+ * JSON object; the high-water marks are in bytes
+ * @return the members, without braces
+ */
+string mem_stats::get_json() {
+	ostringstream s;
+	s << "\"memory\":{";
+	for(int m=0; m<NUM_MEM_SUBSYSTEMS; m++) {
+		counters &c=subsystem_counters[m];
+		s << "\"" << get_subsystem_name(m) << "\":{\"allocs\":"
+			<< c.allocs.load() << ",\"frees\":" << c.frees.load()
+			<< ",\"bytes\":" << c.bytes.load() << ",\"live\":"
+			<< c.live.load() << ",\"peak\":" << c.peak.load() << "},";
+	}
+	s << "\"peak\":" << total_peak.load() << "}";
+	return s.str();
+}
+
+
+/**
+ * Function to report the sites that allocated the most bytes
+ * @param n is the number of sites that are reported
+ * @return the lines of the table, from the site with the most bytes
+ */
+string mem_stats::get_top_sites(int n) {
+	vector<pair<uint64_t, int> > by_bytes;
+	int registered=min(num_sites.load(), (int)MAX_SITES);
+	for(int i=0; i<registered; i++) {
+		if(site_counters[i].allocs.load() > 0) {
+			by_bytes.push_back(make_pair(site_counters[i].bytes.load(), i));
+		}
+	}
+	sort(by_bytes.rbegin(), by_bytes.rend());
+
+	ostringstream s;
+	s << left << setw(44) << "site" << setw(10) << "memory" << right
+		<< setw(12) << "allocs" << setw(14) << "KB allocated"
+		<< setw(12) << "KB peak" << endl;
+	for(int i=0; (i<n) && (i<(int)by_bytes.size()); i++) {
+		int site=by_bytes[i].second;
+		ostringstream where;
+		if(site < NUM_MEM_SUBSYSTEMS) {
+			where << ((site == MEM_OTHER) ? "(outside every scope)"
+				: "(external)");
+		}else{
+			where << sites[site].file << ":" << sites[site].line << " "
+				<< sites[site].function;
+		}
+		int m=(site < NUM_MEM_SUBSYSTEMS) ? site : sites[site].subsystem;
+		s << left << setw(44) << where.str() << setw(10)
+			<< get_subsystem_name(m) << right << setw(12)
+			<< site_counters[site].allocs.load() << setw(14)
+			<< to_kb(site_counters[site].bytes.load()) << setw(12)
+			<< to_kb(site_counters[site].peak.load()) << endl;
+	}
+	return s.str();
+}
+
+
+// Function to get the name of a subsystem
+const char *mem_stats::get_subsystem_name(int s) {
+	static const char *const names[NUM_MEM_SUBSYSTEMS]={"other", "tokens",
+		"values", "patterns", "waveforms", "output"};
+	return names[s];
+}
@@ -0,0 +1,163 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Accounting of the allocations of the heap, by subsystem and by site
+ * The accounting is only compiled in when STIL_MEMSTATS is defined ("make
+ * debug"); the global operator new and delete are then replaced, and each
+ * block is charged to the site of the innermost MEM_SCOPE() of the thread
+ * that allocates it, and to the subsystem of that site, until it is freed.
+ * Otherwise, MEM_SCOPE() and MEM_EXTERNAL() expand to nothing. The number of
+ * allocations, the bytes allocated, and the high-water mark of the bytes
+ * that are live are reported with --stats; --mem-top=N lists the N sites
+ * that allocated the most bytes.
+ */
+
+// Import Header files from the C++ STL
+#include <string>
+#include <atomic>
+#include <stdint.h>
+
+
+#ifndef __MEM_STATS_H
+#define __MEM_STATS_H
+using namespace std;
+
+// Subsystems that allocations are charged to
+enum mem_subsystem {
+	MEM_OTHER,			// Allocations outside every MEM_SCOPE()
+	MEM_TOKENS,			// Tokens of the STIL file, and their split strings
+	MEM_VALUES,			// Values of the signals, and their queues
+	MEM_PATTERNS,		// Patterns of scan chains, and snapshots of them
+	MEM_WAVE_PROPS,		// Waveform properties of the signals
+	MEM_OUTPUT,			// Buffers and rows of the output file
+	NUM_MEM_SUBSYSTEMS
+};
+
+// =======================================================================
+
+// Class definition...
+class mem_stats {
+	public:
+		// Initialize constants...
+		// Maximum number of sites; allocations of further sites are OTHER
+		static const int MAX_SITES = 256;
+		// Number of sites that are listed by --mem-top by default
+		static const int DEFAULT_TOP = 10;
+
+		/**
+		 * Guard that charges the allocations of this thread to a site for
+		 * its scope, and to the site that it was entered from afterwards
+		 */
+		class scope {
+			public:
+				scope(int site) : previous(current_site) {
+					current_site=site;
+				}
+				~scope() {
+					current_site=previous;
+				}
+
+			private:
+				int previous;
+				// Copy constructor and assignment are not supported
+				scope(const scope &);
+				scope &operator=(const scope &);
+		};
+
+		// Define headers for functions...
+		/**
+		 * Register a site of a subsystem, at a line of a function; the site
+		 * of allocations outside every scope is MEM_OTHER
+		 */
+		static int register_site(mem_subsystem subsystem, const char *file,
+			int line, const char *function);
+		// Site of the allocations of this thread
+		static int get_current_site();
+		/**
+		 * Charge n bytes to a site, or give them back; memory that is not
+		 * allocated by operator new (such as aligned buffers) is charged to
+		 * the site of its subsystem with MEM_EXTERNAL()
+		 */
+		static void allocated(int site, uint64_t n);
+		static void freed(int site, uint64_t n);
+
+		// Is the accounting compiled in?
+		static bool is_compiled_in();
+		// Report by subsystem as a table, or as the members of a JSON object
+		static string get_table();
+		static string get_json();
+		// Report the n sites that allocated the most bytes, as a table
+		static string get_top_sites(int n);
+		// Name of a subsystem
+		static const char *get_subsystem_name(int s);
+
+
+	private:
+		/**
+		 * Counters of a site, or of a subsystem: allocations, frees, bytes
+		 * allocated, bytes live, and the high-water mark of the bytes live
+		 */
+		struct counters {
+			atomic<uint64_t> allocs;
+			atomic<uint64_t> frees;
+			atomic<uint64_t> bytes;
+			atomic<int64_t> live;
+			atomic<int64_t> peak;
+		};
+		// Where a site is, and its subsystem
+		struct site_info {
+			const char *file;
+			int line;
+			const char *function;
+			int subsystem;
+		};
+
+		// Declaration of class variables...
+		// Site of the allocations of each thread
+		static thread_local int current_site;
+		// Number of sites that are registered
+		static atomic<int> num_sites;
+		static site_info sites[MAX_SITES];
+		static counters site_counters[MAX_SITES];
+		static counters subsystem_counters[NUM_MEM_SUBSYSTEMS];
+		// Bytes live in the whole heap, and their high-water mark
+		static atomic<int64_t> total_live;
+		static atomic<int64_t> total_peak;
+
+		// Add n bytes (a negative number frees them) to the live bytes
+		static void add_live(atomic<int64_t> &live, atomic<int64_t> &peak,
+			int64_t n);
+};
+
+
+#ifdef STIL_MEMSTATS
+// Name of the guard, and of the site, of a MEM_SCOPE() on a line
+#define MEM_JOIN(a, b) a##b
+#define MEM_NAME(name, line) MEM_JOIN(name, line)
+/**
+ * Charge the allocations of this thread to this line of the function, of
+ * the subsystem, until the end of the enclosing block
+ */
+#define MEM_SCOPE(subsystem) \
+	static const int MEM_NAME(mem_site_, __LINE__)= \
+		mem_stats::register_site(subsystem, __FILE__, __LINE__, __func__); \
+	mem_stats::scope MEM_NAME(mem_scope_, __LINE__)(MEM_NAME(mem_site_, __LINE__))
+/**
+ * Charge n bytes that are not allocated by operator new to the subsystem;
+ * a negative n gives them back
+ */
+#define MEM_EXTERNAL(subsystem, n) \
+	do { \
+		if((n) >= 0) { \
+			mem_stats::allocated(subsystem, (n)); \
+		}else{ \
+			mem_stats::freed(subsystem, -(n)); \
+		} \
+	} while(0)
+#else
+#define MEM_SCOPE(subsystem) do { } while(0)
+#define MEM_EXTERNAL(subsystem, n) do { } while(0)
+#endif
+#endif
@@ -0,0 +1,394 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Output layer that writes the output file through a large, aligned buffer
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #Direct I/O requires that the buffer, the offset and the size of each
+ *	write are aligned to the block size of the file system. ALIGNMENT is
+ *	assumed to be a multiple of that block size. The unaligned tail of the
+ *	file is written after direct I/O is switched off, when the file is closed.
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "output_buffer.h"
+#include "mem_stats.h"
+#include "ViolatedAssertion.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// =======================================================================
+
+// Default constructor
+output_buffer::output_buffer() {
+	allocate(DEFAULT_BUFFER_SIZE);
+}
+
+// Standard constructor
+output_buffer::output_buffer(size_t size_of_buffer) {
+	allocate(size_of_buffer);
+}
+
+/**
+ * Destructor; it must not throw, since it may run whilst the stack is
+ * unwound, so a failure to write the rest of the buffer is swallowed, and
+ * the file is closed. Callers see the errors of writing by calling close().
+ */
+output_buffer::~output_buffer() {
+	try {
+		close();
+	}catch(ViolatedAssertion &e) {
+	}catch(ViolatedPrecondition &e) {
+	}
+	free(buffer);
+	MEM_EXTERNAL(MEM_OUTPUT, -(int64_t)buf_size);
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to allocate the aligned buffer
+ * @param size_of_buffer is the size of the buffer; it is rounded up to a
+ *	multiple of ALIGNMENT
+ * @return nothing
+ */
+void output_buffer::allocate(size_t size_of_buffer) {
+	fd=-1;
+	used=0;
+	file_offset=0;
+	direct_io=false;
+	fadvise=false;
+
+	// Round the size of the buffer up to whole aligned blocks
+	if(size_of_buffer < ALIGNMENT) {
+		size_of_buffer=ALIGNMENT;
+	}
+	buf_size=((size_of_buffer+ALIGNMENT-1)/ALIGNMENT)*ALIGNMENT;
+
+	void *p=NULL;
+	if(posix_memalign(&p, ALIGNMENT, buf_size) != 0) {
+		throw ViolatedAssertion("Output buffer cannot be allocated");
+	}
+	buffer=(char *)p;
+	MEM_EXTERNAL(MEM_OUTPUT, (int64_t)buf_size);
+}
+
+
+/**
+ * Function to open the output file
+ * @param filename is the name of the output file; it is truncated
+ * @return true if the output file is opened; else, return false
+ */
+bool output_buffer::open(string filename) {
+	// Close any output file that is still open
+	close();
+
+	out_file=filename;
+	fd=::open(out_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	used=0;
+	file_offset=0;
+	return (fd >= 0);
+}
+
+
+// Is the output file open?
+bool output_buffer::is_open() {
+	return (fd >= 0);
+}
+
+
+/**
+ * Function to flush the buffer, and close the output file
+ * The file is closed, and the buffer emptied, even if the buffer cannot be
+ * written
+ * @throws ViolatedAssertion exception if the buffer cannot be written
+ * @return nothing
+ */
+void output_buffer::close() {
+	if(fd < 0) {
+		return;
+	}
+
+	try {
+		flush();
+		// Is there an unaligned tail that direct I/O could not write?
+		if(used > 0) {
+			// Switch off direct I/O to write the tail
+			set_direct_io(false);
+			flush();
+		}
+	}catch(ViolatedAssertion &e) {
+		::close(fd);
+		fd=-1;
+		used=0;
+		throw;
+	}
+
+	::close(fd);
+	fd=-1;
+}
+
+
+/**
+ * Function to write the contents of the buffer to the output file
+ * With direct I/O, the unaligned remainder of the buffer is kept in the
+ * buffer, until the buffer is flushed again or the file is closed
+ * Without an open output file, the contents of the buffer are discarded
+ * @return nothing
+ */
+void output_buffer::flush() {
+	if(fd < 0) {
+		used=0;
+		return;
+	}
+	if(used == 0) {
+		return;
+	}
+
+	// Number of bytes to be written
+	size_t n=used;
+	if(direct_io) {
+		n=(used/ALIGNMENT)*ALIGNMENT;
+	}
+
+	write_out(buffer, n);
+
+	// Move the unwritten remainder to the start of the buffer
+	if(n < used) {
+		memmove(buffer, buffer+n, used-n);
+	}
+	used=used-n;
+}
+
+
+/**
+ * Function to write n bytes to the output file at the current file offset
+ * @param data is the start of the bytes to be written
+ * @param n is the number of bytes to be written
+ * @throws ViolatedAssertion exception if the bytes cannot be written
+ * @return nothing
+ */
+void output_buffer::write_out(const char *data, size_t n) {
+	// Offset of the first byte that is written by this call
+	uint64_t start=file_offset;
+
+	while(n > 0) {
+		ssize_t w=::write(fd, data, n);
+		if(w < 0) {
+			// Retry writes that are interrupted
+			if(errno == EINTR) {
+				continue;
+			}
+			cerr<<"Output file is:"<<out_file<<"; "<<strerror(errno)<<endl;
+			throw ViolatedAssertion("Output file cannot be written");
+		}
+		data=data+w;
+		n=n-w;
+		file_offset=file_offset+w;
+	}
+
+#ifdef POSIX_FADV_DONTNEED
+	if(fadvise && !direct_io && (file_offset > start)) {
+#ifdef SYNC_FILE_RANGE_WRITE
+		// Start the write-back of this block...
+		sync_file_range(fd, start, file_offset-start, SYNC_FILE_RANGE_WRITE);
+#endif
+		// ... and drop the blocks that have already been written back
+		posix_fadvise(fd, 0, start, POSIX_FADV_DONTNEED);
+	}
+#endif
+}
+
+
+/**
+ * Function to append n characters to the buffer
+ * @param data is the start of the characters
+ * @param n is the number of characters
+ * @return nothing
+ */
+void output_buffer::write(const char *data, size_t n) {
+	while(n > 0) {
+		// Is the buffer full?
+		if(used == buf_size) {
+			flush();
+		}
+
+		// Copy as many characters as the buffer can hold
+		size_t space=buf_size-used;
+		size_t c=(n < space) ? n : space;
+		memcpy(buffer+used, data, c);
+		used=used+c;
+		data=data+c;
+		n=n-c;
+	}
+}
+
+
+// Function to append the string s to the buffer
+void output_buffer::write(const string &s) {
+	write(s.data(), s.size());
+}
+
+
+// Function to append the character c to the buffer
+void output_buffer::put(char c) {
+	if(used == buf_size) {
+		flush();
+	}
+	buffer[used]=c;
+	used++;
+}
+
+
+// Function to append the character c to the buffer, n times
+void output_buffer::fill(char c, size_t n) {
+	while(n > 0) {
+		if(used == buf_size) {
+			flush();
+		}
+		size_t space=buf_size-used;
+		size_t r=(n < space) ? n : space;
+		memset(buffer+used, c, r);
+		used=used+r;
+		n=n-r;
+	}
+}
+
+
+/**
+ * Function to switch direct I/O on or off for the output file
+ * @param enable is true if the page cache is to be bypassed
+ * @return true if direct I/O is in use
+ */
+bool output_buffer::set_direct_io(bool enable) {
+	if(fd < 0) {
+		throw ViolatedPrecondition("Output file is not open");
+	}
+
+#ifdef O_DIRECT
+	int flags=fcntl(fd, F_GETFL);
+	if(flags < 0) {
+		return false;
+	}
+
+	if(enable) {
+		/**
+		 * The offset of the next write must be aligned; write out whatever
+		 * has been buffered before switching
+		 */
+		flush();
+		if((file_offset%ALIGNMENT) != 0) {
+			return false;
+		}
+		flags=flags | O_DIRECT;
+	}else{
+		flags=flags & (~O_DIRECT);
+	}
+
+	if(fcntl(fd, F_SETFL, flags) < 0) {
+		// The file system does not support direct I/O
+		direct_io=false;
+		return false;
+	}
+	direct_io=enable;
+#else
+	direct_io=false;
+#endif
+	return direct_io;
+}
+
+
+/**
+ * Function to advise the kernel on how the output file is written
+ * @param enable is true if the written pages are to be dropped from the
+ *	page cache
+ * @return nothing
+ */
+void output_buffer::set_fadvise(bool enable) {
+	fadvise=enable;
+#ifdef POSIX_FADV_SEQUENTIAL
+	if(enable && (fd >= 0)) {
+		posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	}
+#endif
+}
+
+
+/**
+ * Function to reserve a region at the end of the output file, which is
+ * written with write_at, possibly by several threads
+ * The contents of the buffer are written out, so that the region starts
+ * after them; the writes to the region need not be aligned, so direct I/O
+ * is switched off
+ * @param n is the size of the region
+ * @throws ViolatedPrecondition exception if the output file is not open
+ * @return the offset of the region in the output file
+ */
+uint64_t output_buffer::reserve(uint64_t n) {
+	if(fd < 0) {
+		throw ViolatedPrecondition("Output file is not open");
+	}
+	if(direct_io) {
+		set_direct_io(false);
+	}
+	flush();
+
+	uint64_t start=file_offset;
+	file_offset=file_offset+n;
+	// Subsequent writes through the buffer follow the region
+	if(lseek(fd, file_offset, SEEK_SET) == (off_t)-1) {
+		throw ViolatedAssertion("Output file cannot be extended");
+	}
+	return start;
+}
+
+
+/**
+ * Function to write n bytes at an offset of the output file, bypassing the
+ * buffer; different threads may write disjoint regions at the same time
+ * @param offset is the offset of the first byte in the output file
+ * @param data is the start of the bytes to be written
+ * @param n is the number of bytes to be written
+ * @throws ViolatedAssertion exception if the bytes cannot be written
+ * @return nothing
+ */
+void output_buffer::write_at(uint64_t offset, const char *data, size_t n) {
+	while(n > 0) {
+		ssize_t w=pwrite(fd, data, n, offset);
+		if(w < 0) {
+			// Retry writes that are interrupted
+			if(errno == EINTR) {
+				continue;
+			}
+			cerr<<"Output file is:"<<out_file<<"; "<<strerror(errno)<<endl;
+			throw ViolatedAssertion("Output file cannot be written");
+		}
+		data=data+w;
+		n=n-w;
+		offset=offset+w;
+	}
+}
+
+
+// Number of bytes that have been written, including buffered bytes
+uint64_t output_buffer::bytes_written() {
+	return file_offset+used;
+}
+
+
+// File descriptor of the output file
+int output_buffer::get_fd() {
+	return fd;
+}
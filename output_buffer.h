@@ -0,0 +1,118 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Output layer that writes the output file through a large, aligned buffer
+ * The buffer is only written to the file when it is full, or at explicit
+ * flush points; unlike an ofstream that is flushed with every endl
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <string>
+#include <stdint.h>
+#include <stddef.h>
+
+
+#ifndef __OUTPUT_BUFFER_H
+#define __OUTPUT_BUFFER_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class output_buffer {
+	public:
+		// Initialize constants...
+		// Default size of the buffer: 4 MB
+		static const size_t DEFAULT_BUFFER_SIZE = 4*1024*1024;
+		// Alignment of the buffer, and of each write with direct I/O
+		static const size_t ALIGNMENT = 4096;
+
+		// Default constructor
+		output_buffer();
+		// Standard Constructor...
+		output_buffer(size_t size_of_buffer);
+		/**
+		 * Destructor; flushes and closes the output file, without throwing;
+		 * call close() to see whether the file was written
+		 */
+		~output_buffer();
+
+		// Define headers for functions...
+		// Open the output file, truncating it
+		bool open(string filename);
+		// Is the output file open?
+		bool is_open();
+		// Flush the buffer and close the output file
+		void close();
+		/**
+		 * Explicit flush point; write the contents of the buffer to the file
+		 * With direct I/O, only whole aligned blocks are written
+		 */
+		void flush();
+
+		// Append characters to the buffer
+		void write(const char *data, size_t n);
+		void write(const string &s);
+		void put(char c);
+		// Append the character c, n times
+		void fill(char c, size_t n);
+
+		/**
+		 * Bypass the page cache with O_DIRECT, if the file system
+		 * supports it
+		 * @return true if direct I/O is in use
+		 */
+		bool set_direct_io(bool enable);
+		/**
+		 * Advise the kernel that the file is written sequentially, and drop
+		 * the written pages from the page cache as each block is flushed
+		 */
+		void set_fadvise(bool enable);
+
+		/**
+		 * Reserve n bytes at the end of the file, to be written with
+		 * write_at; the buffer is written out first, and direct I/O is
+		 * switched off
+		 * @return the offset of the first reserved byte
+		 */
+		uint64_t reserve(uint64_t n);
+		// Write n bytes at the given offset, without the buffer; thread-safe
+		void write_at(uint64_t offset, const char *data, size_t n);
+
+		// Number of bytes that have been written, including buffered bytes
+		uint64_t bytes_written();
+		// File descriptor of the output file; -1 if it is not open
+		int get_fd();
+
+
+	private:
+		// Declaration of instance variables...
+		// Name of the output file
+		string out_file;
+		// File descriptor of the output file
+		int fd;
+		// Aligned buffer
+		char *buffer;
+		// Size of the buffer
+		size_t buf_size;
+		// Number of bytes in the buffer
+		size_t used;
+		// Offset in the file of the first byte in the buffer
+		uint64_t file_offset;
+		// Is direct I/O in use?
+		bool direct_io;
+		// Are the pages dropped from the page cache as they are written?
+		bool fadvise;
+
+		// Write n bytes from data to the file at the current file offset
+		void write_out(const char *data, size_t n);
+		// Allocate the aligned buffer
+		void allocate(size_t size_of_buffer);
+		// Copy constructor and assignment are not supported
+		output_buffer(const output_buffer &);
+		output_buffer &operator=(const output_buffer &);
+};
+#endif
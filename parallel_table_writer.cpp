@@ -0,0 +1,186 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Writer of the table of signals, which formats the rows on the worker
+ * threads of a thread pool; see parallel_table_writer.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #The values of the signals do not change until the table is written
+ * #The output file is the same, byte for byte, as the one that is written
+ *	by file_analyzer::dump_output() on a single thread
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <string.h>
+
+#include "parallel_table_writer.h"
+#include "mem_stats.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// =======================================================================
+
+// Standard constructor
+parallel_table_writer::parallel_table_writer(output_buffer &out,
+	thread_pool &threads) : outputfile(out), pool(threads) {
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+// Function to add a line of text, without its newline
+void parallel_table_writer::add_line(string text) {
+	table_line l;
+	l.prefix=text;
+	l.values=NULL;
+	l.offset=0;
+	lines.push_back(l);
+}
+
+
+/**
+ * Function to add the row of a signal: its name, left aligned with tabs,
+ * and its values
+ * @param s is the signal; its values are read when the table is written
+ * @return nothing
+ */
+void parallel_table_writer::add_row(signalZ *s) {
+	table_line l;
+	l.prefix=s->row_prefix();
+	l.values=&(s->get_sig_values());
+	l.offset=0;
+	lines.push_back(l);
+}
+
+
+/**
+ * Function to format a chunk of a line into its buffer
+ * @param c is the index of the chunk
+ * @return nothing
+ * O(n) computational time complexity, for n characters in the chunk
+ */
+void parallel_table_writer::format_chunk(size_t c) {
+	MEM_SCOPE(MEM_OUTPUT);
+	table_chunk &ch=chunks[c];
+	const table_line &l=lines[ch.line];
+	uint64_t prefix_size=l.prefix.size();
+	uint64_t values_size=(l.values == NULL) ? 0 : l.values->size();
+
+	string text;
+	text.reserve(ch.last-ch.first);
+	for(uint64_t pos=ch.first; pos<ch.last; ) {
+		if(pos < prefix_size) {
+			// Part of the prefix
+			uint64_t n=((ch.last < prefix_size) ? ch.last : prefix_size)-pos;
+			text.append(l.prefix, pos, n);
+			pos=pos+n;
+		}else if(pos < (prefix_size+values_size)) {
+			// Part of the values
+			uint64_t end=(ch.last < (prefix_size+values_size))
+				? ch.last : (prefix_size+values_size);
+			text.append(*(l.values), pos-prefix_size, end-pos);
+			pos=end;
+		}else{
+			// End of the line
+			text.push_back('\n');
+			pos++;
+		}
+	}
+
+	lock_guard<mutex> lk(chunk_lock);
+	ch.text.swap(text);
+	ch.ready=true;
+	chunk_ready.notify_all();
+}
+
+
+/**
+ * Function to write the lines of the table
+ * The offsets of the lines are computed, and the region of the table is
+ * reserved in the output file. A window of chunks is formatted by the pool,
+ * while the chunks are written in order, each at its offset.
+ * @return nothing
+ */
+void parallel_table_writer::write() {
+	// Split the lines into chunks, and compute the offset of each line
+	chunks.clear();
+	uint64_t total=0;
+	for(size_t i=0; i<lines.size(); i++) {
+		uint64_t size=lines[i].prefix.size() + 1;
+		if(lines[i].values != NULL) {
+			size=size+lines[i].values->size();
+		}
+		lines[i].offset=total;
+		for(uint64_t first=0; first<size; first=first+CHUNK_SIZE) {
+			table_chunk ch;
+			ch.line=i;
+			ch.first=first;
+			ch.last=((size-first) > CHUNK_SIZE) ? (first+CHUNK_SIZE) : size;
+			ch.ready=false;
+			ch.failed=false;
+			chunks.push_back(ch);
+		}
+		total=total+size;
+	}
+
+	uint64_t start=outputfile.reserve(total);
+	for(size_t i=0; i<lines.size(); i++) {
+		lines[i].offset=lines[i].offset+start;
+	}
+
+	// Number of chunks that are formatted ahead of the writer
+	size_t window=4*pool.get_num_threads();
+	size_t submitted=0;
+	for(size_t c=0; c<chunks.size(); c++) {
+		// Keep the window of chunks full
+		while((submitted < chunks.size()) && (submitted < (c+window))) {
+			size_t k=submitted;
+			pool.submit([this, k] {
+				try {
+					format_chunk(k);
+				}catch(...) {
+					// Release the writer, which rethrows from pool.wait()
+					lock_guard<mutex> lk(chunk_lock);
+					chunks[k].failed=true;
+					chunks[k].ready=true;
+					chunk_ready.notify_all();
+					throw;
+				}
+			});
+			submitted++;
+		}
+
+		// Wait for the next chunk in order, and write it at its offset
+		string text;
+		{
+			unique_lock<mutex> lk(chunk_lock);
+			chunk_ready.wait(lk, [this, c] { return chunks[c].ready; });
+			text.swap(chunks[c].text);
+		}
+		if(chunks[c].failed) {
+			pool.wait();
+		}
+		outputfile.write_at(lines[chunks[c].line].offset + chunks[c].first,
+			text.data(), text.size());
+	}
+	pool.wait();
+}
+
+
+// Offset of the line "i" in the output file
+uint64_t parallel_table_writer::get_line_offset(size_t i) {
+	if(i >= lines.size()) {
+		throw ViolatedPrecondition("Line is out of range");
+	}
+	return lines[i].offset;
+}
+
+
+// Offset of the first value of the line "i" in the output file
+uint64_t parallel_table_writer::get_value_offset(size_t i) {
+	return get_line_offset(i) + lines[i].prefix.size();
+}
@@ -0,0 +1,91 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Writer of the table of signals, which formats the rows on the worker
+ * threads of a thread pool
+ * The size of each line of the table is known before it is formatted, so
+ * the offset of each line in the output file is computed first. The lines
+ * are split into chunks; each chunk is formatted into a private buffer by a
+ * worker, and the chunks are written in order, at their offsets, by the
+ * thread that writes the table.
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "output_buffer.h"
+#include "signalZ.h"
+#include "thread_pool.h"
+
+
+#ifndef __PARALLEL_TABLE_WRITER_H
+#define __PARALLEL_TABLE_WRITER_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class parallel_table_writer {
+	public:
+		// Initialize constants...
+		// Largest number of characters in a chunk of a line
+		static const size_t CHUNK_SIZE = 1024*1024;
+
+		// Standard Constructor...
+		parallel_table_writer(output_buffer &out, thread_pool &threads);
+
+		// Define headers for functions...
+		// Add a line of text, without its newline
+		void add_line(string text);
+		// Add the row of a signal
+		void add_row(signalZ *s);
+		// Write the lines in the order that they are added
+		void write();
+		// Offsets of the line "i", and of its first value, in the output file
+		uint64_t get_line_offset(size_t i);
+		uint64_t get_value_offset(size_t i);
+
+
+	private:
+		// Line of the table: a prefix (text, or name of a signal) and values
+		struct table_line {
+			string prefix;
+			const string *values;
+			uint64_t offset;
+		};
+		// Chunk of a line, which is formatted by a worker
+		struct table_chunk {
+			size_t line;
+			// Range of the line, including its prefix and its newline
+			uint64_t first;
+			uint64_t last;
+			string text;
+			// Has it been formatted? Did its formatting fail?
+			bool ready;
+			bool failed;
+		};
+
+		// Declaration of instance variables...
+		output_buffer &outputfile;
+		thread_pool &pool;
+		vector<table_line> lines;
+		vector<table_chunk> chunks;
+		// Lock and condition for the chunks that are ready
+		mutex chunk_lock;
+		condition_variable chunk_ready;
+
+		// Format a chunk into its buffer
+		void format_chunk(size_t c);
+		// Copy constructor and assignment are not supported
+		parallel_table_writer(const parallel_table_writer &);
+		parallel_table_writer &operator=(const parallel_table_writer &);
+};
+#endif
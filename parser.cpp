@@ -8,23 +8,646 @@
 // Import Header files from the C++ STL
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <cstring>
 #include <math.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include "file_analyzer.h"
+#include "pattern_reader.h"
+#include "thread_pool.h"
+#include "batch_runner.h"
+#include "stil_daemon.h"
+#include "trace.h"
+#include "mem_stats.h"
+#include "trace_events.h"
+#include "ViolatedAssertion.h"
+#include "ViolatedPrecondition.h"
 
 using namespace std;
 
+// =======================================================================
+
+/**
+ * Function to obtain the value of an option of the form --name=value
+ * @param option is the option given to the program
+ * @param name is the name of the option, including its "=" sign
+ * @param value is assigned the value of the option, if it is found
+ * @return true if the option has this name; else, return false
+ */
+bool option_value(string option, string name, string &value) {
+	if(option.compare(0, name.size(), name) != 0) {
+		return false;
+	}
+	value=option.substr(name.size());
+	return true;
+}
+
+
+/**
+ * Function to convert the value of an option into a number
+ * @param value is the value of the option
+ * @param n is assigned the number, if the value is a number
+ * @return true if the value is a non-negative decimal number; else, return
+ *	false
+ */
+bool option_number(string value, long long &n) {
+	if(value.empty() || (value.find_first_not_of("0123456789") != string::npos)) {
+		return false;
+	}
+	errno=0;
+	n=strtoll(value.c_str(), NULL, 10);
+	return errno == 0;
+}
+
+
+/**
+ * Function to convert the value of an option into a number of threads
+ * @param value is the value of the option; 0 for all hardware threads
+ * @param n is assigned the number of threads, if the value is a number
+ * @return true if the value is a number of threads; else, return false
+ */
+bool option_threads(string value, int &n) {
+	long long threads;
+	if((!option_number(value, threads)) || (threads > INT_MAX)) {
+		return false;
+	}
+	n=(threads == 0) ? thread_pool::hardware_threads() : (int)threads;
+	return true;
+}
+
+
+/**
+ * Function to print the contents of a binary pattern file; see
+ * read_binary_pattern()
+ * @throws ViolatedPrecondition exception if the file is not a valid binary
+ *	pattern file
+ * @return the exit status of the program
+ */
+int print_binary_pattern(int argc, char *argv[]) {
+	pattern_reader pr(argv[2]);
+	if(argc < 6) {
+		cout << "Date: " << pr.get_date() << endl;
+		cout << "Quantum (ps): " << pr.get_quantum() << endl;
+		cout << "Cycles: " << pr.get_num_cycles() << endl;
+		cout << "Stride of cycle index: " << pr.get_index_stride() << endl;
+		for(uint32_t i=0; i<pr.get_num_wfts(); i++) {
+			cout << "WaveformTable " << pr.get_wft_name(i) << ": period (ps) ";
+			cout << pr.get_wft_period(i) << endl;
+		}
+		for(uint32_t i=0; i<pr.get_num_signals(); i++) {
+			cout << (pr.is_input(i) ? "In\t" : "Out\t");
+			cout << pr.get_signal_name(i) << "\t" << pr.get_num_samples(i);
+			cout << endl;
+		}
+		return 0;
+	}
+
+	int sig=pr.find_signal(argv[3]);
+	if(sig < 0) {
+		cerr << "Signal " << argv[3] << " is not found" << endl;
+		return 1;
+	}
+	long long first;
+	long long count;
+	if((!option_number(argv[4], first)) || (!option_number(argv[5], count))) {
+		cerr << "The first value and the count must be numbers" << endl;
+		return 1;
+	}
+	cout << pr.get_signal_name(sig) << "\t";
+	cout << pr.get_samples(sig, first, count) << endl;
+	return 0;
+}
+
+
+/**
+ * Function to print the contents of a binary pattern file
+ * i.e., [program name] --read [binary filename] [signal first count]
+ * Without a signal, the header and the signal table are printed; else,
+ * "count" values of the signal are printed from the value "first"
+ * @return the exit status of the program; 1 if the file is not a valid
+ *	binary pattern file, or the signal or its values are invalid
+ */
+int read_binary_pattern(int argc, char *argv[]) {
+	if(argc < 3) {
+		cout << "i.e., [program name] --read [binary filename]";
+		cout << " [signal first count]" << endl;
+		return 0;
+	}
+
+	try {
+		return print_binary_pattern(argc, argv);
+	}catch(ViolatedPrecondition &e) {
+		cerr << e.get_message() << endl;
+		return 1;
+	}
+}
+
+
+/**
+ * Function to look values up in a table file; see lookup_table()
+ * @param by_cycle is true if the values are looked up from a cycle
+ * @throws ViolatedPrecondition exception if the index is not a valid index
+ *	of a table
+ * @throws ViolatedAssertion exception if the table file does not match its
+ *	index
+ * @return the exit status of the program
+ */
+int print_lookup(int argc, char *argv[], bool by_cycle) {
+	table_index ti;
+	ti.open(table_index::index_filename(argv[2]));
+	if(argc < 6) {
+		cout << "Cycles: " << ti.get_num_cycles() << endl;
+		cout << "Cycles in each chunk: " << ti.get_index_stride() << endl;
+		for(uint32_t i=0; i<ti.get_num_rows(); i++) {
+			cout << ti.get_name(i) << "\t" << ti.get_num_values(i) << endl;
+		}
+		return 0;
+	}
+
+	int row=ti.find_row(argv[3]);
+	if(row < 0) {
+		cerr << "Signal " << argv[3] << " is not found" << endl;
+		return 1;
+	}
+	long long first_arg;
+	long long count_arg;
+	if((!option_number(argv[4], first_arg))
+		|| (!option_number(argv[5], count_arg))) {
+
+		cerr << (by_cycle ? "The cycle" : "The first value");
+		cerr << " and the count must be numbers" << endl;
+		return 1;
+	}
+	uint64_t first=first_arg;
+	uint64_t count=count_arg;
+	// Range of the cycles, widened to the chunks that hold them
+	uint64_t first_cycle=0;
+	uint64_t end_cycle=0;
+	if(by_cycle) {
+		uint64_t num_cycles=ti.get_num_cycles();
+		if(first >= num_cycles) {
+			cerr << "Cycle " << first << " is out of range; the table has "
+				<< num_cycles << " cycles" << endl;
+			return 1;
+		}
+		first_cycle=ti.get_chunk_cycle(first);
+		end_cycle=(count < num_cycles-first) ? (first+count) : num_cycles;
+		if(ti.get_chunk_cycle(end_cycle) != end_cycle) {
+			end_cycle=ti.get_chunk_cycle(end_cycle)+ti.get_index_stride();
+			if(end_cycle > num_cycles) {
+				end_cycle=num_cycles;
+			}
+		}
+		first=ti.get_chunk_value(row, first_cycle);
+		count=ti.get_chunk_value(row, end_cycle)-first;
+	}
+	int fd=open(argv[2], O_RDONLY);
+	if(fd < 0) {
+		cerr << "Table file " << argv[2] << " cannot be opened" << endl;
+		return 1;
+	}
+	string values;
+	try {
+		values=ti.read_values(fd, row, first, count);
+	}catch(ViolatedAssertion &e) {
+		close(fd);
+		throw;
+	}
+	close(fd);
+	cout << ti.get_name(row) << "\t";
+	if(by_cycle) {
+		cout << first_cycle << ":" << end_cycle << "\t";
+	}else{
+		cout << first << "\t";
+	}
+	cout << values << endl;
+	return 0;
+}
+
+
+/**
+ * Function to look values up in a table file, through its sidecar index
+ * i.e., [program name] --lookup [table filename] [signal first count]
+ * or [program name] --lookup-cycle [table filename] [signal cycle count]
+ * Without a signal, the rows of the index are printed; else, "count" values
+ * of the signal are printed from the value "first", or the values of the
+ * chunks of cycles that hold the "count" cycles from "cycle". Chunks are
+ * the finest grain of the index, so the cycles are widened to the start of
+ * the chunk of "cycle" and to the end of the chunk of the last cycle (or
+ * the end of the pattern); the range of cycles that is printed, "A:B" for
+ * the cycles A to B-1, precedes the values.
+ * @param by_cycle is true if the values are looked up from a cycle
+ * @return the exit status of the program; 1 if the index or the table file
+ *	is invalid, or the signal or its values are invalid, which is reported
+ *	on the standard error
+ */
+int lookup_table(int argc, char *argv[], bool by_cycle) {
+	if(argc < 3) {
+		cout << "i.e., [program name] " << argv[1] << " [table filename]";
+		cout << (by_cycle ? " [signal cycle count]" : " [signal first count]");
+		cout << endl;
+		return 0;
+	}
+
+	try {
+		return print_lookup(argc, argv, by_cycle);
+	}catch(ViolatedPrecondition &e) {
+		cerr << e.get_message() << endl;
+		return 1;
+	}catch(ViolatedAssertion &e) {
+		cerr << e.get_message() << endl;
+		return 1;
+	}
+}
+
+/**
+ * Options that follow the names of the input and output files, or of the
+ * batch; see parse_options()
+ */
+struct run_options {
+	bool direct_io;
+	bool fadvise;
+	bool streaming;
+	bool write_index;
+	bool pipelined;
+	int num_threads;
+	// Number of files that are parsed at the same time in a batch
+	int num_jobs;
+	string selection;
+	long long first_cycle;
+	long long last_cycle;
+	int output_format;
+	int index_stride;
+	// Quantization unit of time, in nanoseconds
+	int measure_of_time;
+	// Print the statistics of the run: 0 for none, 1 as a table, 2 as JSON
+	int stats_format;
+	// Number of sites of allocations that are listed; 0 for none
+	int mem_top;
+	// File of the timeline of the run; empty for none
+	string trace_file;
+};
+
+
+/**
+ * Function to parse the options of the program
+ * Options that do not apply to the selected format are dropped, with a
+ * warning
+ * @param first is the index of the first option in argv
+ * @param opts is assigned the options
+ * @return true if the options are valid; else, return false
+ */
+bool parse_options(int argc, char *argv[], int first, run_options &opts) {
+	opts.direct_io=false;
+	opts.fadvise=false;
+	opts.streaming=false;
+	opts.write_index=false;
+	opts.pipelined=false;
+	opts.stats_format=0;
+	opts.mem_top=0;
+	opts.num_threads=1;
+	opts.num_jobs=thread_pool::hardware_threads();
+	opts.first_cycle=0;
+	opts.last_cycle=-1;
+	opts.output_format=file_analyzer::FORMAT_TABLE;
+	opts.index_stride=file_analyzer::DEFAULT_INDEX_STRIDE;
+	opts.measure_of_time=file_analyzer::MEASURE_OF_TIME;
+	// Value of the currently processed option, and its number
+	string value;
+	long long number;
+	for(int i=first; i<argc; i++) {
+		string option=argv[i];
+		if(option == "--direct-io") {
+			opts.direct_io=true;
+		}else if(option == "--fadvise") {
+			opts.fadvise=true;
+		}else if(option == "--stream") {
+			opts.streaming=true;
+		}else if(option == "--index") {
+			opts.write_index=true;
+		}else if(option == "--pipeline") {
+			opts.pipelined=true;
+		}else if(option == "--stats") {
+			opts.stats_format=1;
+		}else if(option == "--stats=json") {
+			opts.stats_format=2;
+		}else if(option_value(option, "--format=", value)) {
+			if(value == "table") {
+				opts.output_format=file_analyzer::FORMAT_TABLE;
+			}else if(value == "binary") {
+				opts.output_format=file_analyzer::FORMAT_BINARY;
+			}else if(value == "vcd") {
+				opts.output_format=file_analyzer::FORMAT_VCD;
+			}else if(value == "vector") {
+				opts.output_format=file_analyzer::FORMAT_VECTOR;
+			}else{
+				cerr << "Unknown format: " << value << endl;
+				return false;
+			}
+		}else if(option_value(option, "--select=", value)) {
+			opts.selection=value;
+		}else if(option_value(option, "--threads=", value)) {
+			if(!option_threads(value, opts.num_threads)) {
+				cerr << "Number of threads must be a number: " << value << endl;
+				return false;
+			}
+		}else if(option_value(option, "--jobs=", value)) {
+			if(!option_threads(value, opts.num_jobs)) {
+				cerr << "Number of jobs must be a number: " << value << endl;
+				return false;
+			}
+		}else if(option_value(option, "--index-stride=", value)) {
+			if((!option_number(value, number)) || (number < 1)
+				|| (number > INT_MAX)) {
 
-// Instance variables
-// Names for input and output file streams
-string input_filename;
-string output_filename;
+				cerr << "Stride of the cycle index must be a positive number";
+				cerr << " of cycles: " << value << endl;
+				return false;
+			}
+			opts.index_stride=number;
+		}else if(option_value(option, "--quantum=", value)) {
+			if((!option_number(value, number)) || (number < 1)
+				|| (number > INT_MAX)) {
+
+				cerr << "Quantum of time must be a positive number of ";
+				cerr << file_analyzer::UNIT_OF_TIME << endl;
+				return false;
+			}
+			opts.measure_of_time=number;
+		}else if(option_value(option, "--trace=", value)) {
+#ifdef STIL_TRACE
+			try {
+				trace::set(value);
+			}catch(ViolatedPrecondition &e) {
+				cerr << e.get_message() << "; the categories are ";
+				cerr << trace::get_category_names() << endl;
+				return false;
+			}
+#else
+			cerr << "The trace is compiled out; --trace is ignored, unless";
+			cerr << " the program is built with make debug" << endl;
+#endif
+		}else if((option == "--mem-top")
+			|| option_value(option, "--mem-top=", value)) {
+
+#ifdef STIL_MEMSTATS
+			opts.mem_top=mem_stats::DEFAULT_TOP;
+			if(option != "--mem-top") {
+				if((!option_number(value, number)) || (number > INT_MAX)) {
+					cerr << "Number of sites must be a number: " << value;
+					cerr << endl;
+					return false;
+				}
+				opts.mem_top=number;
+			}
+#else
+			cerr << "The accounting of the allocations is compiled out;";
+			cerr << " --mem-top is ignored, unless the program is built";
+			cerr << " with make debug" << endl;
+#endif
+		}else if(option_value(option, "--trace-events=", value)) {
+			opts.trace_file=value;
+		}else if(option_value(option, "--cycles=", value)) {
+			size_t colon=value.find(':');
+			if(colon == string::npos) {
+				cerr << "Slice of cycles must be A:B, or A: for the end";
+				cerr << endl;
+				return false;
+			}
+			if((!option_number(value.substr(0, colon), opts.first_cycle))
+				|| (((colon+1) < value.size())
+				&& ((!option_number(value.substr(colon+1), opts.last_cycle))
+				|| (opts.last_cycle <= opts.first_cycle)))) {
+
+				cerr << "Slice of cycles must be A:B, or A: for the end";
+				cerr << endl;
+				return false;
+			}
+		}else{
+			cerr << "Unknown option: " << option << endl;
+			return false;
+		}
+	}
+
+	bool table=(opts.output_format == file_analyzer::FORMAT_TABLE);
+	// The other formats need all values of each signal
+	if(opts.streaming && (!table)) {
+		cerr << "Only the table format can be streamed; --stream is ignored";
+		cerr << endl;
+		opts.streaming=false;
+	}
+	// The sidecar index is only written for the table of signals
+	if(opts.write_index && (opts.streaming || (!table))) {
+		cerr << "Only the table of signals can be indexed; --index is ignored";
+		cerr << endl;
+		opts.write_index=false;
+	}
+	return true;
+}
+
+
+/**
+ * Function to apply the options to a file_analyzer, before it parses its
+ * input file
+ * @param fa is the file_analyzer
+ * @param opts is the options
+ * @return true if they are applied; false if the slice of cycles is
+ *	invalid, which is reported on the standard error
+ */
+bool apply_options(file_analyzer &fa, const run_options &opts) {
+	if(opts.direct_io && (!fa.set_direct_io(true))) {
+		cout << "Direct I/O is not supported for the output file" << endl;
+	}
+	fa.set_fadvise(opts.fadvise);
+	fa.set_output_format(opts.output_format);
+	fa.set_index_stride(opts.index_stride);
+	fa.set_streaming(opts.streaming);
+	fa.set_table_index(opts.write_index);
+	fa.set_pipelined(opts.pipelined);
+	fa.set_num_threads(opts.num_threads);
+	fa.set_selection(opts.selection);
+	fa.set_measure_of_time(opts.measure_of_time);
+	try {
+		fa.set_cycle_range(opts.first_cycle, opts.last_cycle);
+	}catch(ViolatedPrecondition &e) {
+		cerr << e.get_message() << endl;
+		return false;
+	}
+	return true;
+}
+
+
+/**
+ * Function to start the timeline of the run, if it is written
+ * @param opts is the options of the run
+ * @return nothing
+ */
+void start_timeline(const run_options &opts) {
+	if(!opts.trace_file.empty()) {
+		trace_events::start();
+		trace_events::set_thread_name("main");
+	}
+}
+
+
+/**
+ * Function to write the timeline of the run, if it is written
+ * @param opts is the options of the run
+ * @return nothing
+ */
+void write_timeline(const run_options &opts) {
+	if(opts.trace_file.empty()) {
+		return;
+	}
+	try {
+		trace_events::write(opts.trace_file);
+	}catch(ViolatedPrecondition &e) {
+		cerr << e.get_message() << endl;
+	}
+}
+
+
+/**
+ * Function to parse a batch of STIL files in this process
+ * i.e., [program name] --batch [list file or directory] [output directory]
+ * [options]
+ * The files are parsed on --jobs=N threads, from the largest to the
+ * smallest; the status of each file is printed at the end
+ * @return the exit status of the program; 1 if any file failed
+ */
+int run_batch(int argc, char *argv[]) {
+	if(argc < 4) {
+		cout << "i.e., [program name] --batch [list file or directory]";
+		cout << " [output directory] [options]" << endl;
+		return 0;
+	}
+	run_options opts;
+	if(!parse_options(argc, argv, 4, opts)) {
+		return 1;
+	}
+	if(opts.stats_format > 0) {
+		cout << "The statistics are only measured for a single file;";
+		cout << " --stats is ignored" << endl;
+	}
+
+	// Extension of the output files
+	string ext=".txt";
+	if(opts.output_format == file_analyzer::FORMAT_BINARY) {
+		ext=".bin";
+	}else if(opts.output_format == file_analyzer::FORMAT_VCD) {
+		ext=".vcd";
+	}
+	batch_runner batch(argv[3], ext);
+	batch.add_inputs(argv[2]);
+	batch.set_configure([&opts](file_analyzer &fa) {
+		apply_options(fa, opts);
+	});
+	start_timeline(opts);
+	int failed=batch.run(opts.num_jobs);
+	write_timeline(opts);
+	batch.print_summary(cout);
+	return (failed > 0) ? 1 : 0;
+}
+
+
+/**
+ * Function to run the resident query daemon on a Unix domain socket
+ * i.e., [program name] --daemon [socket] [--budget=MB] [--threads=N]
+ * The daemon answers until it is sent SHUTDOWN; see stil_daemon.h
+ * @return the exit status of the program
+ */
+int run_daemon(int argc, char *argv[]) {
+	if(argc < 3) {
+		cout << "i.e., [program name] --daemon [socket] [--budget=MB]";
+		cout << " [--threads=N]" << endl;
+		return 0;
+	}
+	// Memory of the cached files, in MB, and connections answered at once
+	uint64_t budget=stil_daemon::DEFAULT_BUDGET_MB;
+	int num_threads=thread_pool::hardware_threads();
+	string value;
+	for(int i=3; i<argc; i++) {
+		string option=argv[i];
+		long long number;
+		if(option_value(option, "--budget=", value)) {
+			if(!option_number(value, number)) {
+				cerr << "Budget must be a number of MB: " << value << endl;
+				return 1;
+			}
+			budget=number;
+		}else if(option_value(option, "--threads=", value)) {
+			if(!option_threads(value, num_threads)) {
+				cerr << "Number of threads must be a number: " << value << endl;
+				return 1;
+			}
+		}else{
+			cerr << "Unknown option: " << option << endl;
+			return 1;
+		}
+	}
+	stil_daemon daemon(argv[2], budget*1024*1024);
+	daemon.run(num_threads);
+	return 0;
+}
+
+
+/**
+ * Function to send a request to the resident query daemon
+ * i.e., [program name] --query [socket] [request]
+ * The words of the request are joined with spaces; the response is printed
+ * @return the exit status of the program; 1 if the daemon is not reached,
+ *	or if it answers with an error
+ */
+int run_query(int argc, char *argv[]) {
+	if(argc < 4) {
+		cout << "i.e., [program name] --query [socket] [request]" << endl;
+		return 0;
+	}
+	string request=argv[3];
+	for(int i=4; i<argc; i++) {
+		request=request + " " + argv[i];
+	}
+	ostringstream response;
+	if(!stil_daemon::query(argv[2], request, response)) {
+		cerr << "Daemon cannot be reached on " << argv[2] << endl;
+		return 1;
+	}
+	cout << response.str();
+	return (response.str().compare(0, 2, "OK") == 0) ? 0 : 1;
+}
 
 // =======================================================================
 
 // Start of main function...
 int main(int argc, char *argv[]) {
+	// Print the contents of a binary pattern file?
+	if((argc > 1) && (string(argv[1]) == "--read")) {
+		return read_binary_pattern(argc, argv);
+	}
+	// Look values up in a table file, through its index?
+	if((argc > 1) && (string(argv[1]) == "--lookup")) {
+		return lookup_table(argc, argv, false);
+	}
+	if((argc > 1) && (string(argv[1]) == "--lookup-cycle")) {
+		return lookup_table(argc, argv, true);
+	}
+	// Parse a batch of STIL files?
+	if((argc > 1) && (string(argv[1]) == "--batch")) {
+		return run_batch(argc, argv);
+	}
+	// Answer queries on STIL files, or query the daemon?
+	if((argc > 1) && (string(argv[1]) == "--daemon")) {
+		return run_daemon(argc, argv);
+	}
+	if((argc > 1) && (string(argv[1]) == "--query")) {
+		return run_query(argc, argv);
+	}
+
 	cout << "========================================================" << endl;
 	cout << "Start parsing the STIL input file... And process it."<<endl;
 
@@ -32,17 +655,66 @@ int main(int argc, char *argv[]) {
 	 * If the first two input arguments for this program is null,
 	 * request for the user to rerun the program and exit.
 	 */
-	if((argv[1] == NULL) || (argv[2] == NULL)) {
+	if((argc < 3) || (argv[1] == NULL) || (argv[2] == NULL)) {
 		cout << "Please enter the names for the input and output files" << endl;
 		cout << "when you rerun this program" << endl;
-		cout << "i.e., [program name] [input filename] [output filename]" << endl;
+		cout << "i.e., [program name] [input filename] [output filename]";
+		cout << " [options]" << endl;
+		cout << "The options are:" << endl;
+		cout << "--direct-io:__Write the output file with O_DIRECT" << endl;
+		cout << "--fadvise:____Drop written output from the page cache" << endl;
+		cout << "--stream:_____Write a row of all signals for each cycle,";
+		cout << " as it is executed" << endl;
+		cout << "--format=[table|binary|vcd|vector]:__Format of the output file" << endl;
+		cout << "--index-stride=N:__Cycles between checkpoints of the";
+		cout << " cycle index" << endl;
+		cout << "--index:______Write the sidecar index of the table" << endl;
+		cout << "--select=LIST:__Expand and write only the signals, groups or";
+		cout << " glob patterns in the comma-separated LIST" << endl;
+		cout << "--threads=N:__Threads that expand the signals and format";
+		cout << " the table; 0 for all hardware threads" << endl;
+		cout << "--cycles=A:B:__Write only the cycles from A to B-1;";
+		cout << " B may be omitted for the end of the pattern" << endl;
+		cout << "--pipeline:___Lex, expand the signals and write the output";
+		cout << " on their own threads, whilst the pattern is executed" << endl;
+		cout << "--quantum=N:__Quantization unit of time of the values, in ";
+		cout << file_analyzer::UNIT_OF_TIME << "; ";
+		cout << file_analyzer::MEASURE_OF_TIME << " by default" << endl;
+		cout << "--stats[=json]:__Print the time of each phase, and the";
+		cout << " counters of the run, on the standard error" << endl;
+		cout << "--trace=SPEC:__Trace categories at levels 0-3, such as";
+		cout << " pattern:3,values; only in builds of make debug" << endl;
+		cout << "--trace-events=FILE:__Write the timeline of the phases,";
+		cout << " Macros, procedures, jobs and stalls of the threads to FILE,";
+		cout << " in the Chrome trace event format" << endl;
+		cout << "--mem-top[=N]:__List the N sites that allocated the most";
+		cout << " bytes, on the standard error; only in builds of make debug";
+		cout << endl;
+		cout << "To print a binary pattern file:" << endl;
+		cout << "[program name] --read [binary filename] [signal first count]";
+		cout << endl;
+		cout << "To look values up in an indexed table file:" << endl;
+		cout << "[program name] --lookup [table filename] [signal first count]";
+		cout << endl;
+		cout << "[program name] --lookup-cycle [table filename]";
+		cout << " [signal cycle count]" << endl;
+		cout << "To parse a batch of STIL files, from a list file (one name";
+		cout << " on each line) or a directory:" << endl;
+		cout << "[program name] --batch [list file or directory]";
+		cout << " [output directory] [options]" << endl;
+		cout << "--jobs=N:_____Files of the batch that are parsed at the";
+		cout << " same time; all hardware threads by default" << endl;
+		cout << "To answer queries on STIL files, from memory, on a Unix";
+		cout << " domain socket:" << endl;
+		cout << "[program name] --daemon [socket] [--budget=MB]";
+		cout << " [--threads=N]" << endl;
+		cout << "[program name] --query [socket] [request]" << endl;
 		return 0;
-	}else{
-		// Assign the first input argument to the program as the input filename
-		input_filename = argv[1];
-		// Assign the 2nd input argument to the program as the output filename
-		output_filename = argv[2];
 	}
+	// Assign the first input argument to the program as the input filename
+	string input_filename = argv[1];
+	// Assign the 2nd input argument to the program as the output filename
+	string output_filename = argv[2];
 // Delete this block of code
 	cout << "1st argument..." << endl;
 	cout << input_filename << endl;
@@ -50,14 +722,42 @@ int main(int argc, char *argv[]) {
 	cout << output_filename << endl;	
 	
 
+	// Options that follow the names of the input and output files
+	run_options opts;
+	if(!parse_options(argc, argv, 3, opts)) {
+		return 1;
+	}
+
 	// Prepare to parse the input file, process it, and produce the output file
 	file_analyzer *fa = new file_analyzer(input_filename, output_filename);
+	// Apply the options for writing the output file
+	if(!apply_options(*fa, opts)) {
+		delete fa;
+		return 1;
+	}
+	// Measure the phases of the run?
+	run_stats *stats=NULL;
+	if(opts.stats_format > 0) {
+		stats=new run_stats();
+		fa->set_stats(stats);
+	}
+	start_timeline(opts);
 	/**
 	 * Parse the input file to produce an output text file indicating the
 	 * test patterns for the automatic test equipment
 	 */
 	fa->parse_input();
-	string be = fa->time_to_string(35, 1);
+	write_timeline(opts);
+	if(stats != NULL) {
+		stats->finish();
+		cerr << ((opts.stats_format == 2) ? stats->get_json() + "\n"
+			: stats->get_table());
+		delete stats;
+	}
+	if(opts.mem_top > 0) {
+		cerr << mem_stats::get_top_sites(opts.mem_top);
+	}
+	string be = fa->time_to_string(7*fa->get_measure_of_time(), 1);
 	
 	// Try to see if the static method in SignalZ will work
 /*
@@ -65,7 +765,7 @@ int main(int argc, char *argv[]) {
 	cout<<"Val of period in SignalZ:"<<signalZ::get_sig_period()<<"<:::"<<endl;
 */	
 	cout << "1Test pattern:::" << be << endl;
-	be = fa->time_to_string(20, 0);
+	be = fa->time_to_string(4*fa->get_measure_of_time(), 0);
 	cout << "2Test pattern:::" << be << endl;
 	be = fa->int_to_str(5126759);
 	cout << "3Test pattern:::" << be << endl;
@@ -124,7 +824,7 @@ cout<<"3TRUN:::"<<fa->truncate_whitespace("#$%^&*SDFGH   t786 * T*		J	")<<endl;
 */
 	cout << "========================================================" << endl;
 	cout << "Note that the logic values are represented every ";
-	cout << file_analyzer::MEASURE_OF_TIME << file_analyzer::UNIT_OF_TIME;
+	cout << fa->get_measure_of_time() << file_analyzer::UNIT_OF_TIME;
 	cout << " in time." << endl;
 	cout << "" << endl;
 	cout << "Definition for logic values of signals:" << endl;
@@ -0,0 +1,101 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Layout of the compact binary pattern format
+ *
+ * The file is made of the following sections; each section starts at an
+ * offset that is a multiple of 8 bytes, so that the file can be mapped into
+ * memory and read in place:
+ * #File header (pattern_header)
+ * #Signal table: a pattern_signal for each signal, inputs before outputs
+ * #WaveformTable table: a pattern_wft for each WaveformTable
+ * #String table: names of the signals, WaveformTables and the test date
+ * #State planes: the packed values of each signal, in the order of the
+ *	signal table. Each value is an index into the states of its signal,
+ *	packed into 1, 2, 4 or 8 bits; the first value is in the lowest bits of
+ *	the first byte. With 8 bits, the value is the character itself.
+ * #Cycle index: for every index_stride cycles, the offset of the first
+ *	value of that cycle in each signal; checkpoint-major, that is, the
+ *	offsets of all signals for checkpoint 0, then for checkpoint 1, ...
+ *
+ * All integers are little-endian.
+ */
+
+// Import Header files from the C++ STL
+#include <stdint.h>
+
+
+#ifndef __PATTERN_FORMAT_H
+#define __PATTERN_FORMAT_H
+
+// =======================================================================
+
+// Magic number at the start of the file, followed by the version
+#define PATTERN_MAGIC "STILPAT1"
+#define PATTERN_VERSION 1
+// Maximum number of states that are mapped by a signal
+#define PATTERN_MAX_STATES 16
+// Direction of a signal
+#define PATTERN_INPUT 0
+#define PATTERN_OUTPUT 1
+
+
+// Header of the file
+struct pattern_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t num_signals;
+	// Quantization unit of time of each value, in picoseconds
+	uint64_t quantum_ps;
+	uint32_t num_wfts;
+	// Number of cycles between two checkpoints of the cycle index
+	uint32_t index_stride;
+	// Number of cycles (V vectors) in the pattern
+	uint64_t num_cycles;
+	// Number of checkpoints in the cycle index
+	uint64_t num_checkpoints;
+	// Offsets of the sections from the start of the file
+	uint64_t signal_table_offset;
+	uint64_t wft_table_offset;
+	uint64_t string_table_offset;
+	uint64_t index_offset;
+	// Test date from the Header block; an offset into the string table
+	uint32_t date_offset;
+	uint32_t date_length;
+};
+
+
+// Entry of the signal table
+struct pattern_signal {
+	// Offset of the state plane from the start of the file
+	uint64_t plane_offset;
+	// Number of values of the signal
+	uint64_t num_samples;
+	// Name of the signal; an offset into the string table
+	uint32_t name_offset;
+	uint32_t name_length;
+	// PATTERN_INPUT or PATTERN_OUTPUT
+	uint8_t direction;
+	// Number of bits for each value: 1, 2, 4 or 8
+	uint8_t bits_per_sample;
+	// Number of states in the map of states; 0 with 8 bits per value
+	uint8_t num_states;
+	uint8_t reserved;
+	// Characters of the states, indexed by the packed values
+	char states[PATTERN_MAX_STATES];
+	uint32_t reserved2;
+};
+
+
+// Entry of the WaveformTable table
+struct pattern_wft {
+	// Period of the WaveformTable in picoseconds
+	uint64_t period_ps;
+	// Name of the WaveformTable; an offset into the string table
+	uint32_t name_offset;
+	uint32_t name_length;
+};
+
+#endif
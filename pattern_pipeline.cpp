@@ -0,0 +1,303 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Pipeline of the stages that follow the execution of the pattern; see
+ * pattern_pipeline.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #Whilst cycles are in flight, the thread that executes the pattern does
+ *	not read the values of the signals, or change the state that their
+ *	expansion depends upon; signalZ calls sync() before it does so
+ * #Whilst the output stage runs, nothing else writes to the output file
+ * #The output file is the same, byte for byte, as the one that is written
+ *	when the stages run on a single thread
+ */
+
+// Import Header files from the C++ STL and the directory
+#include "pattern_pipeline.h"
+#include "signalZ.h"
+#include "mem_stats.h"
+#include "trace_events.h"
+#include "ViolatedAssertion.h"
+
+using namespace std;
+
+// Pipeline whose expansion stage runs on this thread; NULL for other threads
+static thread_local pattern_pipeline *stage_pipeline=NULL;
+
+// =======================================================================
+
+// Standard constructor
+pattern_pipeline::pattern_pipeline(output_buffer &out) : outputfile(out),
+	batches(RING_SIZE), rows(RING_SIZE), num_completed(0), failed(false) {
+
+	streaming=false;
+	cycle_index=NULL;
+	running=false;
+	num_submitted=0;
+}
+
+// Destructor
+pattern_pipeline::~pattern_pipeline() {
+	if(running) {
+		// The stages are stopped; their failure is of no interest anymore
+		batches.close();
+		expander.join();
+		if(writer.joinable()) {
+			writer.join();
+		}
+	}
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+// Function to add a signal to the pipeline
+void pattern_pipeline::add_signal(signalZ *s) {
+	signals.push_back(s);
+}
+
+
+/**
+ * Function to start the expansion stage, and the output stage
+ * @param stream_rows is true if a row is formatted and written for the
+ *	cycles that are handed with write_row
+ * @param index is the cycle index that the checkpoints are appended to
+ * @return nothing
+ */
+void pattern_pipeline::start(bool stream_rows, vector<uint64_t> *index) {
+	streaming=stream_rows;
+	cycle_index=index;
+	current.values.resize(signals.size());
+	current.patterns.resize(signals.size());
+	expander=thread(&pattern_pipeline::run_expansion, this);
+	if(streaming) {
+		writer=thread(&pattern_pipeline::run_output, this);
+	}
+	running=true;
+}
+
+
+/**
+ * Function to hand the values that each signal has queued in this cycle to
+ * the expansion stage
+ * @param cycle is the index of the cycle
+ * @param write_row is true if a row is written for this cycle
+ * @throws the first exception that was thrown by a stage
+ * @return nothing
+ * O(n) computational time complexity, for n queued waveform characters
+ */
+void pattern_pipeline::end_of_cycle(long long cycle, bool write_row) {
+	if(failed.load(memory_order_acquire)) {
+		sync();
+	}
+	for(size_t i=0; i<signals.size(); i++) {
+		signals[i]->take_pending(current.values[i], current.patterns[i]);
+		current.ends.push_back(current.values[i].size());
+	}
+	current.cycles.push_back(cycle);
+	current.rows.push_back(write_row);
+	if(current.cycles.size() >= BATCH_CYCLES) {
+		submit();
+	}
+}
+
+
+// Function to record a checkpoint after the cycles that have been handed
+void pattern_pipeline::checkpoint() {
+	current.checkpoints.push_back(current.cycles.size());
+}
+
+
+/**
+ * Function to hand the current batch over to the expansion stage, and to
+ * start a new batch
+ * @return nothing
+ */
+void pattern_pipeline::submit() {
+	if(current.cycles.empty() && current.checkpoints.empty()) {
+		return;
+	}
+	batches.push(current);
+	num_submitted++;
+
+	current=cycle_batch();
+	current.values.resize(signals.size());
+	current.patterns.resize(signals.size());
+}
+
+
+/**
+ * Function to wait until every cycle that has been handed is processed
+ * @throws ViolatedAssertion exception if it is called by the expansion
+ *	stage, which would wait for itself
+ * @throws the first exception that was thrown by a stage
+ * @return nothing
+ */
+void pattern_pipeline::sync() {
+	if(!running) {
+		return;
+	}
+	if(stage_pipeline == this) {
+		throw ViolatedAssertion("Expansion stage cannot wait for itself");
+	}
+	submit();
+	if(num_completed.load(memory_order_acquire) < num_submitted) {
+		trace_events::scope stall("sync wait");
+		while(num_completed.load(memory_order_acquire) < num_submitted) {
+			this_thread::yield();
+		}
+	}
+	if(failed.load(memory_order_acquire)) {
+		rethrow_exception(failure);
+	}
+}
+
+
+/**
+ * Function to process the remaining cycles, and to stop the stages
+ * @throws the first exception that was thrown by a stage
+ * @return nothing
+ */
+void pattern_pipeline::finish() {
+	if(!running) {
+		return;
+	}
+	submit();
+	batches.close();
+	expander.join();
+	if(writer.joinable()) {
+		writer.join();
+	}
+	running=false;
+	if(failed.load(memory_order_acquire)) {
+		rethrow_exception(failure);
+	}
+}
+
+
+// Function to record the exception of a stage, unless one is recorded
+void pattern_pipeline::record_failure() {
+	lock_guard<mutex> lk(failure_lock);
+	if(!failed.load(memory_order_relaxed)) {
+		failure=current_exception();
+		failed.store(true, memory_order_release);
+	}
+}
+
+
+/**
+ * Function that runs the expansion stage, until the batches are closed
+ * After a failure, the batches are still taken, so that the execution
+ * stage is never blocked, but they are not expanded
+ * @return nothing
+ */
+void pattern_pipeline::run_expansion() {
+	stage_pipeline=this;
+	trace_events::set_thread_name("expansion");
+	cycle_batch b;
+	while(batches.pop(b)) {
+		string text;
+		if(!failed.load(memory_order_acquire)) {
+			try {
+				trace_events::scope event("expand batch");
+				expand_batch(b, text);
+			}catch(...) {
+				record_failure();
+			}
+		}
+		if(streaming) {
+			// The batch is completed once its rows are written
+			rows.push(text);
+		}else{
+			num_completed.fetch_add(1, memory_order_release);
+		}
+	}
+	rows.close();
+}
+
+
+/**
+ * Function that runs the output stage, until the rows are closed
+ * @return nothing
+ */
+void pattern_pipeline::run_output() {
+	trace_events::set_thread_name("output");
+	string text;
+	while(rows.pop(text)) {
+		if(!failed.load(memory_order_acquire)) {
+			try {
+				trace_events::scope event("write rows");
+				outputfile.write(text);
+			}catch(...) {
+				record_failure();
+			}
+		}
+		num_completed.fetch_add(1, memory_order_release);
+	}
+}
+
+
+/**
+ * Function to expand the cycles of a batch
+ * The characters of the signals are expanded up to each cycle whose row is
+ * written, and up to each checkpoint; else, all cycles of a signal are
+ * expanded together.
+ * @param b is the batch
+ * @param text is appended the rows of the batch
+ * @return nothing
+ * O(n) computational time complexity, for n values
+ */
+void pattern_pipeline::expand_batch(cycle_batch &b, string &text) {
+	size_t n=signals.size();
+	size_t num_cycles=b.cycles.size();
+	vector<size_t> first(n, 0);
+	size_t next_checkpoint=0;
+	for(size_t c=0; c<=num_cycles; c++) {
+		// Checkpoints that precede the cycle "c"
+		while((next_checkpoint < b.checkpoints.size())
+			&& (b.checkpoints[next_checkpoint] == c)) {
+
+			for(size_t i=0; i<n; i++) {
+				if(signals[i]->is_selected()) {
+					cycle_index->push_back(signals[i]->num_expanded());
+				}
+			}
+			next_checkpoint++;
+		}
+		if(c == num_cycles) {
+			break;
+		}
+
+		// Is the expansion stopped after this cycle?
+		bool row=streaming && b.rows[c];
+		if((!row) && (c != (num_cycles-1))
+			&& ((next_checkpoint >= b.checkpoints.size())
+				|| (b.checkpoints[next_checkpoint] != (c+1)))) {
+
+			continue;
+		}
+		for(size_t i=0; i<n; i++) {
+			size_t last=b.ends[c*n+i];
+			signals[i]->expand_values(b.values[i], first[i], last,
+				b.patterns[i]);
+			first[i]=last;
+		}
+
+		if(row) {
+			// Index of this cycle, followed by the values of each signal
+			MEM_SCOPE(MEM_OUTPUT);
+			text.append(to_string(b.cycles[c]));
+			for(size_t i=0; i<n; i++) {
+				if(signals[i]->is_selected()) {
+					text.push_back('\t');
+					signals[i]->take_values(text);
+				}
+			}
+			text.push_back('\n');
+		}
+	}
+}
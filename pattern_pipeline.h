@@ -0,0 +1,134 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Pipeline of the stages that follow the execution of the pattern
+ * The thread that executes the statements of the pattern only queues the
+ * waveform characters of each signal. At the end of each cycle, the queued
+ * characters are handed, a batch of cycles at a time, through a bounded
+ * ring to the expansion stage, which expands them into values on its own
+ * thread. When the cycles are streamed, the expansion stage formats a row
+ * for each cycle, and hands the rows through another ring to the output
+ * stage, which writes them to the output file on its own thread.
+ */
+
+// Import Header files from the C++ STL
+#include <string>
+#include <vector>
+#include <list>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "output_buffer.h"
+#include "spsc_ring.h"
+
+class signalZ;
+
+
+#ifndef __PATTERN_PIPELINE_H
+#define __PATTERN_PIPELINE_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class pattern_pipeline {
+	public:
+		// Initialize constants...
+		// Number of cycles in each batch that is handed to the expansion stage
+		static const size_t BATCH_CYCLES = 64;
+		// Number of batches that can be in flight between two stages
+		static const size_t RING_SIZE = 16;
+
+		// Standard Constructor...
+		pattern_pipeline(output_buffer &out);
+		// Destructor; stops the stages
+		~pattern_pipeline();
+
+		// Define headers for functions...
+		// Add a signal; the columns of the rows are in the order of addition
+		void add_signal(signalZ *s);
+		/**
+		 * Start the stages; a row is formatted for a cycle if stream_rows,
+		 * and checkpoints are appended to index
+		 */
+		void start(bool stream_rows, vector<uint64_t> *index);
+		// Hand the queued values of the cycle to the expansion stage
+		void end_of_cycle(long long cycle, bool write_row);
+		/**
+		 * Record the number of values of each selected signal, once the
+		 * cycles that have been handed so far are expanded
+		 */
+		void checkpoint();
+		/**
+		 * Wait until the stages have processed every cycle that has been
+		 * handed so far, so that the signals can be read or changed
+		 * @throws the first exception that was thrown by a stage
+		 */
+		void sync();
+		// Process the remaining cycles, and stop the stages
+		void finish();
+
+
+	private:
+		// Batch of cycles that is handed to the expansion stage
+		struct cycle_batch {
+			// Waveform characters of each signal over the cycles of the batch
+			vector<string> values;
+			// Patterns of the "#" characters of each signal, in order
+			vector< list<string> > patterns;
+			/**
+			 * End of the characters of the cycle "c" of the signal "i" in its
+			 * values, at ends[c*(number of signals)+i]
+			 */
+			vector<size_t> ends;
+			// Index of each cycle, and is a row written for it?
+			vector<long long> cycles;
+			vector<bool> rows;
+			/**
+			 * Number of cycles of the batch that precede each checkpoint;
+			 * in ascending order
+			 */
+			vector<size_t> checkpoints;
+		};
+
+		// Declaration of instance variables...
+		output_buffer &outputfile;
+		vector<signalZ *> signals;
+		bool streaming;
+		vector<uint64_t> *cycle_index;
+		// Batch that is being filled by the thread that executes the pattern
+		cycle_batch current;
+		// Rings from the execution stage to the expansion stage, and onwards
+		spsc_ring<cycle_batch> batches;
+		spsc_ring<string> rows;
+		thread expander;
+		thread writer;
+		bool running;
+		// Number of batches that have been handed over, and processed
+		size_t num_submitted;
+		atomic<size_t> num_completed;
+		// First exception that was thrown by a stage
+		exception_ptr failure;
+		atomic<bool> failed;
+		mutex failure_lock;
+
+		// Hand the current batch over to the expansion stage
+		void submit();
+		// Main loops of the expansion and the output stages
+		void run_expansion();
+		void run_output();
+		// Expand a batch, and format its rows
+		void expand_batch(cycle_batch &b, string &text);
+		// Record the exception of a stage
+		void record_failure();
+		// Copy constructor and assignment are not supported
+		pattern_pipeline(const pattern_pipeline &);
+		pattern_pipeline &operator=(const pattern_pipeline &);
+};
+#endif
@@ -0,0 +1,334 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Reader of the compact binary pattern format; see pattern_format.h
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "pattern_reader.h"
+#include "ViolatedAssertion.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// =======================================================================
+
+// Default constructor
+pattern_reader::pattern_reader() {
+	base=NULL;
+	size=0;
+}
+
+// Standard constructor
+pattern_reader::pattern_reader(string filename) {
+	base=NULL;
+	size=0;
+	open(filename);
+}
+
+// Destructor
+pattern_reader::~pattern_reader() {
+	close();
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to map the file into memory, and to check its header
+ * Every section, string and state plane that the header and the tables
+ * refer to must lie within the file, so that a truncated or corrupt file
+ * is rejected here rather than read out of bounds
+ * @param filename is the name of the binary pattern file
+ * @throws ViolatedPrecondition exception if the file cannot be opened, or
+ *	is not a valid binary pattern file
+ * @return nothing
+ */
+void pattern_reader::open(string filename) {
+	close();
+
+	int fd=::open(filename.c_str(), O_RDONLY);
+	if(fd < 0) {
+		cerr<<"Binary pattern file, with the filename "<<filename
+			<<", does not exist!"<<endl;
+		throw ViolatedPrecondition("Invalid file name");
+	}
+	struct stat st;
+	if((fstat(fd, &st) != 0) || (st.st_size < (off_t)sizeof(pattern_header))) {
+		::close(fd);
+		throw ViolatedPrecondition("Binary pattern file is truncated");
+	}
+
+	size=st.st_size;
+	void *p=mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if(p == MAP_FAILED) {
+		size=0;
+		throw ViolatedPrecondition("Binary pattern file cannot be mapped");
+	}
+	base=(const char *)p;
+
+	// Check the header...
+	header=(const pattern_header *)base;
+	if((memcmp(header->magic, PATTERN_MAGIC, sizeof(header->magic)) != 0)
+		|| (header->version != PATTERN_VERSION)) {
+
+		close();
+		throw ViolatedPrecondition("File is not a binary pattern file");
+	}
+	if(header->index_stride == 0) {
+		close();
+		throw ViolatedPrecondition("Binary pattern file has a stride of 0");
+	}
+
+	// ... and locate the sections
+	check_array(header->signal_table_offset, header->num_signals,
+		sizeof(pattern_signal));
+	check_array(header->wft_table_offset, header->num_wfts,
+		sizeof(pattern_wft));
+	check_section(header->string_table_offset, 0);
+	if(header->num_signals > 0) {
+		check_array(header->index_offset, header->num_checkpoints,
+			(uint64_t)header->num_signals*sizeof(uint64_t));
+	}
+	signal_table=(const pattern_signal *)(base+header->signal_table_offset);
+	wft_table=(const pattern_wft *)(base+header->wft_table_offset);
+	strings=base+header->string_table_offset;
+	cycle_index=(const uint64_t *)(base+header->index_offset);
+
+	// ... and the strings and the state planes that they refer to
+	check_string(header->date_offset, header->date_length);
+	for(uint32_t i=0; i<header->num_wfts; i++) {
+		check_string(wft_table[i].name_offset, wft_table[i].name_length);
+	}
+	for(uint32_t i=0; i<header->num_signals; i++) {
+		const pattern_signal &s=signal_table[i];
+		check_string(s.name_offset, s.name_length);
+		if((s.bits_per_sample != 1) && (s.bits_per_sample != 2)
+			&& (s.bits_per_sample != 4) && (s.bits_per_sample != 8)) {
+
+			close();
+			throw ViolatedPrecondition("Binary pattern file has an invalid"
+				" number of bits for each value");
+		}
+		if(s.num_samples > ((uint64_t)size*8/s.bits_per_sample)) {
+			close();
+			throw ViolatedPrecondition("Binary pattern file is truncated");
+		}
+		check_section(s.plane_offset, (s.num_samples*s.bits_per_sample+7)/8);
+	}
+}
+
+
+// Function to unmap the file
+void pattern_reader::close() {
+	if(base != NULL) {
+		munmap((void *)base, size);
+	}
+	base=NULL;
+	size=0;
+}
+
+
+/**
+ * Function to check that a section lies within the file
+ * @throws ViolatedPrecondition exception if the section is out of bounds
+ */
+void pattern_reader::check_section(uint64_t offset, uint64_t length) {
+	if((offset > size) || (length > (size-offset))) {
+		close();
+		throw ViolatedPrecondition("Binary pattern file is truncated");
+	}
+}
+
+
+/**
+ * Function to check that a table of "count" entries of "width" bytes lies
+ * within the file, without overflowing its length
+ * @throws ViolatedPrecondition exception if the table is out of bounds
+ */
+void pattern_reader::check_array(uint64_t offset, uint64_t count,
+	uint64_t width) {
+
+	if(count > (size/width)) {
+		close();
+		throw ViolatedPrecondition("Binary pattern file is truncated");
+	}
+	check_section(offset, count*width);
+}
+
+
+/**
+ * Function to check that a string lies within the string table and the file
+ * @throws ViolatedPrecondition exception if the string is out of bounds
+ */
+void pattern_reader::check_string(uint32_t offset, uint32_t length) {
+	check_section(header->string_table_offset+offset, length);
+}
+
+
+// Signal entry with bounds checking
+const pattern_signal &pattern_reader::get_signal(uint32_t sig) {
+	if((base == NULL) || (sig >= header->num_signals)) {
+		throw ViolatedPrecondition("Signal is out of range");
+	}
+	return signal_table[sig];
+}
+
+
+// Information in the header...
+uint32_t pattern_reader::get_num_signals() {
+	return header->num_signals;
+}
+
+uint64_t pattern_reader::get_quantum() {
+	return header->quantum_ps;
+}
+
+uint64_t pattern_reader::get_num_cycles() {
+	return header->num_cycles;
+}
+
+uint32_t pattern_reader::get_index_stride() {
+	return header->index_stride;
+}
+
+string pattern_reader::get_date() {
+	return string(strings+header->date_offset, header->date_length);
+}
+
+
+// Information about a signal...
+string pattern_reader::get_signal_name(uint32_t sig) {
+	const pattern_signal &s=get_signal(sig);
+	return string(strings+s.name_offset, s.name_length);
+}
+
+bool pattern_reader::is_input(uint32_t sig) {
+	return (get_signal(sig).direction == PATTERN_INPUT);
+}
+
+uint64_t pattern_reader::get_num_samples(uint32_t sig) {
+	return get_signal(sig).num_samples;
+}
+
+
+/**
+ * Function to search for a signal by its name
+ * @param name is the name of the signal
+ * @return the index of the signal; -1 if it is not found
+ * O(n) computational time complexity
+ */
+int pattern_reader::find_signal(string name) {
+	for(uint32_t i=0; i<header->num_signals; i++) {
+		if((signal_table[i].name_length == name.size())
+			&& (memcmp(strings+signal_table[i].name_offset, name.data(),
+				name.size()) == 0)) {
+
+			return i;
+		}
+	}
+	return -1;
+}
+
+
+// Information about a WaveformTable...
+uint32_t pattern_reader::get_num_wfts() {
+	return header->num_wfts;
+}
+
+string pattern_reader::get_wft_name(uint32_t wft) {
+	if(wft >= header->num_wfts) {
+		throw ViolatedPrecondition("WaveformTable is out of range");
+	}
+	return string(strings+wft_table[wft].name_offset, wft_table[wft].name_length);
+}
+
+uint64_t pattern_reader::get_wft_period(uint32_t wft) {
+	if(wft >= header->num_wfts) {
+		throw ViolatedPrecondition("WaveformTable is out of range");
+	}
+	return wft_table[wft].period_ps;
+}
+
+
+/**
+ * Function to read a value of a signal
+ * @param sig is the index of the signal
+ * @param i is the index of the value
+ * @return the character of the state of the value
+ * O(1) computational time complexity
+ */
+char pattern_reader::get_sample(uint32_t sig, uint64_t i) {
+	const pattern_signal &s=get_signal(sig);
+	if(i >= s.num_samples) {
+		throw ViolatedPrecondition("Value is out of range");
+	}
+
+	const unsigned char *plane=(const unsigned char *)(base+s.plane_offset);
+	if(s.bits_per_sample == 8) {
+		return (char)plane[i];
+	}
+
+	// Locate the packed value within its byte
+	uint64_t bit=i*s.bits_per_sample;
+	unsigned int mask=(1u << s.bits_per_sample)-1;
+	unsigned int code=(plane[bit/8] >> (bit%8)) & mask;
+	return s.states[code];
+}
+
+
+/**
+ * Function to read consecutive values of a signal
+ * @param sig is the index of the signal
+ * @param first is the index of the first value
+ * @param count is the number of values; it is clipped to the last value
+ * @return the characters of the states of the values
+ * O(n) computational time complexity
+ */
+string pattern_reader::get_samples(uint32_t sig, uint64_t first, uint64_t count) {
+	const pattern_signal &s=get_signal(sig);
+	if(first >= s.num_samples) {
+		return "";
+	}
+	if(count > (s.num_samples-first)) {
+		count=s.num_samples-first;
+	}
+
+	string values(count, ' ');
+	for(uint64_t i=0; i<count; i++) {
+		values[i]=get_sample(sig, first+i);
+	}
+	return values;
+}
+
+
+/**
+ * Function to locate the first value of a cycle in a signal
+ * @param sig is the index of the signal
+ * @param cycle is the cycle; it is rounded down to the nearest checkpoint
+ * @return the offset of the first value of that checkpoint in the signal
+ * O(1) computational time complexity
+ */
+uint64_t pattern_reader::get_cycle_offset(uint32_t sig, uint64_t cycle) {
+	get_signal(sig);
+	if(header->num_checkpoints == 0) {
+		throw ViolatedAssertion("Binary pattern file has no cycle index");
+	}
+
+	uint64_t checkpoint=cycle/header->index_stride;
+	if(checkpoint >= header->num_checkpoints) {
+		checkpoint=header->num_checkpoints-1;
+	}
+	return cycle_index[checkpoint*header->num_signals + sig];
+}
@@ -0,0 +1,92 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Reader of the compact binary pattern format; see pattern_format.h
+ * The file is mapped into memory, and its values are read in place
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <string>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "pattern_format.h"
+
+
+#ifndef __PATTERN_READER_H
+#define __PATTERN_READER_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class pattern_reader {
+	public:
+		// Default constructor
+		pattern_reader();
+		// Standard Constructor; opens the file
+		pattern_reader(string filename);
+		// Destructor; unmaps the file
+		~pattern_reader();
+
+		// Define headers for functions...
+		// Map the file into memory, and check its header
+		void open(string filename);
+		void close();
+
+		// Information in the header
+		uint32_t get_num_signals();
+		uint64_t get_quantum();
+		uint64_t get_num_cycles();
+		uint32_t get_index_stride();
+		string get_date();
+
+		// Information about a signal, indexed in the order of the file
+		string get_signal_name(uint32_t sig);
+		bool is_input(uint32_t sig);
+		uint64_t get_num_samples(uint32_t sig);
+		// Index of the signal with the given name; -1 if it is not found
+		int find_signal(string name);
+
+		// Information about a WaveformTable
+		uint32_t get_num_wfts();
+		string get_wft_name(uint32_t wft);
+		uint64_t get_wft_period(uint32_t wft);
+
+		// Value of a signal, as the character of its state
+		char get_sample(uint32_t sig, uint64_t i);
+		// Values of a signal, from the value "first", for "count" values
+		string get_samples(uint32_t sig, uint64_t first, uint64_t count);
+		/**
+		 * Offset of the first value of "cycle" in a signal
+		 * The cycle is rounded down to the nearest checkpoint of the index
+		 */
+		uint64_t get_cycle_offset(uint32_t sig, uint64_t cycle);
+
+
+	private:
+		// Declaration of instance variables...
+		// Start and size of the mapped file
+		const char *base;
+		size_t size;
+		// Sections of the file
+		const pattern_header *header;
+		const pattern_signal *signal_table;
+		const pattern_wft *wft_table;
+		const char *strings;
+		const uint64_t *cycle_index;
+
+		// Check that a section, a table or a string lies within the file
+		void check_section(uint64_t offset, uint64_t length);
+		void check_array(uint64_t offset, uint64_t count, uint64_t width);
+		void check_string(uint32_t offset, uint32_t length);
+		// Signal entry with bounds checking
+		const pattern_signal &get_signal(uint32_t sig);
+		// Copy constructor and assignment are not supported
+		pattern_reader(const pattern_reader &);
+		pattern_reader &operator=(const pattern_reader &);
+};
+#endif
@@ -0,0 +1,293 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Writer of the compact binary pattern format; see pattern_format.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #The values of the signals are held in memory when the file is written;
+ *	the binary format cannot be combined with the streaming output
+ * #The file is written in a single sequential pass; the size of each
+ *	section is computed before it is written
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <stdlib.h>
+#include <string.h>
+
+#include "pattern_writer.h"
+#include "ViolatedAssertion.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// =======================================================================
+
+// Standard constructor
+pattern_writer::pattern_writer(output_buffer &out) : outputfile(out) {
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, PATTERN_MAGIC, sizeof(header.magic));
+	header.version=PATTERN_VERSION;
+	header.index_stride=1;
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+// Set the quantization unit of time in picoseconds
+void pattern_writer::set_quantum(uint64_t quantum_ps) {
+	header.quantum_ps=quantum_ps;
+}
+
+
+// Set the test date from the Header block
+void pattern_writer::set_date(string date) {
+	header.date_offset=add_string(date);
+	header.date_length=date.size();
+}
+
+
+/**
+ * Function to add a WaveformTable to the WaveformTable table
+ * @param name is the name of the WaveformTable
+ * @param period_ps is its period in picoseconds
+ * @return nothing
+ */
+void pattern_writer::add_wft(string name, int64_t period_ps) {
+	pattern_wft w;
+	memset(&w, 0, sizeof(w));
+	w.period_ps=period_ps;
+	w.name_offset=add_string(name);
+	w.name_length=name.size();
+	wft_table.push_back(w);
+}
+
+
+/**
+ * Function to add a signal to the signal table
+ * @param s is the signal, which values are written to the file
+ * @param direction is PATTERN_INPUT or PATTERN_OUTPUT
+ * @return nothing
+ */
+void pattern_writer::add_signal(signalZ *s, uint8_t direction) {
+	pattern_signal entry;
+	memset(&entry, 0, sizeof(entry));
+	entry.name_offset=add_string(s->get_name());
+	entry.name_length=s->get_name().size();
+	entry.direction=direction;
+	entry.num_samples=s->get_sig_values().size();
+	map_states(s->get_sig_values(), entry);
+
+	signals.push_back(s);
+	signal_table.push_back(entry);
+}
+
+
+/**
+ * Function to set the cycle index
+ * @param num_cycles is the number of cycles in the pattern
+ * @param stride is the number of cycles between two checkpoints
+ * @param offsets holds the offset of the values of each signal for each
+ *	checkpoint, checkpoint-major
+ * @throws ViolatedPrecondition exception if the offsets do not hold a
+ *	whole number of checkpoints
+ * @return nothing
+ */
+void pattern_writer::set_cycle_index(uint64_t num_cycles, uint32_t stride,
+	const vector<uint64_t> &offsets) {
+
+	if(signals.empty() || ((offsets.size()%signals.size()) != 0)) {
+		throw ViolatedPrecondition("Cycle index does not match the signals");
+	}
+	header.num_cycles=num_cycles;
+	header.index_stride=stride;
+	header.num_checkpoints=offsets.size()/signals.size();
+	cycle_index=offsets;
+}
+
+
+/**
+ * Function to add a string to the string table
+ * @param s is the string
+ * @return the offset of the string in the string table
+ */
+uint32_t pattern_writer::add_string(string s) {
+	uint32_t offset=strings.size();
+	strings.append(s);
+	return offset;
+}
+
+
+/**
+ * Function to map the states of the values of a signal
+ * A signal with at most 2, 4 or 16 distinct values is packed into 1, 2 or 4
+ * bits for each value; else, each value is kept as a character
+ * @param values are the values of the signal
+ * @param entry is the entry of the signal in the signal table
+ * @return nothing
+ * O(n) computational time complexity
+ */
+void pattern_writer::map_states(const string &values, pattern_signal &entry) {
+	// Flags of the characters that are found in the values
+	bool found[256];
+	memset(found, 0, sizeof(found));
+	int num_found=0;
+
+	for(size_t i=0; i<values.size(); i++) {
+		unsigned char c=(unsigned char)values[i];
+		if(!found[c]) {
+			found[c]=true;
+			num_found++;
+		}
+	}
+
+	if(num_found > PATTERN_MAX_STATES) {
+		// Keep each value as a character
+		entry.bits_per_sample=8;
+		entry.num_states=0;
+		return;
+	}
+
+	// Map the states in the order of their characters
+	entry.num_states=0;
+	for(int c=0; c<256; c++) {
+		if(found[c]) {
+			entry.states[entry.num_states]=(char)c;
+			entry.num_states++;
+		}
+	}
+
+	if(num_found <= 2) {
+		entry.bits_per_sample=1;
+	}else if(num_found <= 4) {
+		entry.bits_per_sample=2;
+	}else{
+		entry.bits_per_sample=4;
+	}
+}
+
+
+/**
+ * Function to write the packed values of a signal
+ * @param values are the values of the signal
+ * @param entry is the entry of the signal in the signal table
+ * @return nothing
+ * O(n) computational time complexity
+ */
+void pattern_writer::write_plane(const string &values, pattern_signal &entry) {
+	if(entry.bits_per_sample == 8) {
+		outputfile.write(values);
+		pad();
+		return;
+	}
+
+	// Map from the characters to the packed values
+	unsigned char code[256];
+	memset(code, 0, sizeof(code));
+	for(int i=0; i<entry.num_states; i++) {
+		code[(unsigned char)entry.states[i]]=(unsigned char)i;
+	}
+
+	// Pack the values into a block of bytes at a time
+	const size_t BLOCK_SIZE=65536;
+	unsigned char block[BLOCK_SIZE];
+	size_t used=0;
+	// Values that are accumulated for the next byte
+	unsigned int acc=0;
+	int acc_bits=0;
+	int bits=entry.bits_per_sample;
+
+	for(size_t i=0; i<values.size(); i++) {
+		acc=acc | (code[(unsigned char)values[i]] << acc_bits);
+		acc_bits=acc_bits+bits;
+		if(acc_bits == 8) {
+			block[used]=(unsigned char)acc;
+			used++;
+			acc=0;
+			acc_bits=0;
+			if(used == BLOCK_SIZE) {
+				outputfile.write((const char *)block, used);
+				used=0;
+			}
+		}
+	}
+	// Write the last partial byte
+	if(acc_bits > 0) {
+		block[used]=(unsigned char)acc;
+		used++;
+	}
+	outputfile.write((const char *)block, used);
+	pad();
+}
+
+
+// Pad the output file to a multiple of 8 bytes
+void pattern_writer::pad() {
+	uint64_t n=outputfile.bytes_written();
+	if((n%8) != 0) {
+		outputfile.fill('\0', 8-(n%8));
+	}
+}
+
+
+/**
+ * Function to write the file
+ * The offsets of the sections are computed, before the file is written in
+ * a single pass
+ * @throws ViolatedAssertion exception if the output file is not empty
+ * @return nothing
+ */
+void pattern_writer::write() {
+	if(outputfile.bytes_written() != 0) {
+		throw ViolatedAssertion("Binary pattern must start the output file");
+	}
+
+	header.num_signals=signal_table.size();
+	header.num_wfts=wft_table.size();
+
+	// Compute the offsets of the sections...
+	uint64_t offset=sizeof(pattern_header);
+	header.signal_table_offset=offset;
+	offset=offset + signal_table.size()*sizeof(pattern_signal);
+	header.wft_table_offset=offset;
+	offset=offset + wft_table.size()*sizeof(pattern_wft);
+	header.string_table_offset=offset;
+	offset=offset + strings.size();
+	offset=((offset+7)/8)*8;
+
+	// ... and of each state plane
+	for(size_t i=0; i<signal_table.size(); i++) {
+		signal_table[i].plane_offset=offset;
+		uint64_t n=(signal_table[i].num_samples*signal_table[i].bits_per_sample+7)/8;
+		offset=offset + ((n+7)/8)*8;
+	}
+	header.index_offset=offset;
+
+	// Write the header and the tables
+	outputfile.write((const char *)&header, sizeof(header));
+	for(size_t i=0; i<signal_table.size(); i++) {
+		outputfile.write((const char *)&signal_table[i], sizeof(pattern_signal));
+	}
+	for(size_t i=0; i<wft_table.size(); i++) {
+		outputfile.write((const char *)&wft_table[i], sizeof(pattern_wft));
+	}
+	outputfile.write(strings);
+	pad();
+
+	// Write the state planes
+	for(size_t i=0; i<signals.size(); i++) {
+		if(outputfile.bytes_written() != signal_table[i].plane_offset) {
+			throw ViolatedAssertion("State plane is misplaced");
+		}
+		write_plane(signals[i]->get_sig_values(), signal_table[i]);
+	}
+
+	// Write the cycle index
+	if(!cycle_index.empty()) {
+		outputfile.write((const char *)&cycle_index[0],
+			cycle_index.size()*sizeof(uint64_t));
+	}
+	outputfile.flush();
+}
@@ -0,0 +1,76 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Writer of the compact binary pattern format; see pattern_format.h
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "pattern_format.h"
+#include "output_buffer.h"
+#include "signalZ.h"
+
+
+#ifndef __PATTERN_WRITER_H
+#define __PATTERN_WRITER_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class pattern_writer {
+	public:
+		// Standard Constructor...
+		pattern_writer(output_buffer &out);
+
+		// Define headers for functions...
+		// Set the quantization unit of time in picoseconds
+		void set_quantum(uint64_t quantum_ps);
+		// Set the test date from the Header block
+		void set_date(string date);
+		// Add a WaveformTable, with its period in picoseconds
+		void add_wft(string name, int64_t period_ps);
+		// Add a signal; direction is PATTERN_INPUT or PATTERN_OUTPUT
+		void add_signal(signalZ *s, uint8_t direction);
+		/**
+		 * Set the cycle index: the offsets of the values of each signal
+		 * at every "stride" cycles, checkpoint-major
+		 */
+		void set_cycle_index(uint64_t num_cycles, uint32_t stride,
+			const vector<uint64_t> &offsets);
+		// Write the file
+		void write();
+
+
+	private:
+		// Declaration of instance variables...
+		// Output file
+		output_buffer &outputfile;
+		// Header of the file
+		pattern_header header;
+		// Signals, their entries in the signal table, and their values
+		vector<signalZ *> signals;
+		vector<pattern_signal> signal_table;
+		// Entries of the WaveformTable table
+		vector<pattern_wft> wft_table;
+		// String table
+		string strings;
+		// Cycle index
+		vector<uint64_t> cycle_index;
+
+		// Add a string to the string table; @return its offset
+		uint32_t add_string(string s);
+		// Map the states of the values of a signal, and choose its packing
+		void map_states(const string &values, pattern_signal &entry);
+		// Write the packed values of a signal
+		void write_plane(const string &values, pattern_signal &entry);
+		// Pad the output file to a multiple of 8 bytes
+		void pad();
+};
+#endif
@@ -0,0 +1,220 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Timings and counters of the phases of a run; see run_stats.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #A run is measured on a single thread; the phases are entered and left
+ *	by the thread that created the statistics
+ * #Time that is spent outside of every phase is reported as "other"
+ * #The allocations of each subsystem are reported too, if their accounting
+ *	is compiled in (see mem_stats.h)
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <sstream>
+#include <iomanip>
+#include <time.h>
+#include <sys/resource.h>
+
+#include "run_stats.h"
+#include "mem_stats.h"
+
+using namespace std;
+
+/**
+ * Function to read a clock
+ * @param clock is the clock to be read
+ * @return its time, in nanoseconds
+ */
+static int64_t clock_ns(clockid_t clock) {
+	struct timespec ts;
+	clock_gettime(clock, &ts);
+	return (int64_t)ts.tv_sec*1000000000LL+ts.tv_nsec;
+}
+
+
+// Function to read the CPU time of the process, in nanoseconds
+static int64_t process_cpu_ns() {
+	struct rusage ru;
+	getrusage(RUSAGE_SELF, &ru);
+	return ((int64_t)ru.ru_utime.tv_sec+ru.ru_stime.tv_sec)*1000000000LL
+		+((int64_t)ru.ru_utime.tv_usec+ru.ru_stime.tv_usec)*1000LL;
+}
+
+
+// Function to format nanoseconds as milliseconds
+static string to_ms(int64_t ns) {
+	ostringstream s;
+	s << fixed << setprecision(3) << (ns/1e6);
+	return s.str();
+}
+
+// =======================================================================
+
+// Standard constructor
+run_stats::run_stats() {
+	for(int p=0; p<NUM_PHASES; p++) {
+		wall_ns[p]=0;
+		cpu_ns[p]=0;
+		calls[p]=0;
+	}
+	start_wall=clock_ns(CLOCK_MONOTONIC);
+	start_cpu=clock_ns(CLOCK_THREAD_CPUTIME_ID);
+	last_wall=start_wall;
+	last_cpu=start_cpu;
+	total_wall=0;
+	total_cpu=0;
+	process_cpu=process_cpu_ns();
+	num_tokens=0;
+	num_cycles=0;
+	num_samples=0;
+	num_bytes=0;
+	peak_rss=0;
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+// Function to charge the time since the last charge to the current phase
+void run_stats::charge() {
+	int64_t wall=clock_ns(CLOCK_MONOTONIC);
+	int64_t cpu=clock_ns(CLOCK_THREAD_CPUTIME_ID);
+	if(!stack.empty()) {
+		wall_ns[stack.back()]+=wall-last_wall;
+		cpu_ns[stack.back()]+=cpu-last_cpu;
+	}
+	last_wall=wall;
+	last_cpu=cpu;
+}
+
+
+/**
+ * Function to enter a phase
+ * The phase that is left for it is charged up to now
+ * @param p is the phase
+ * @return nothing
+ */
+void run_stats::enter(phase p) {
+	charge();
+	stack.push_back(p);
+	calls[p]++;
+}
+
+
+// Function to leave the current phase, which is charged up to now
+void run_stats::leave() {
+	charge();
+	if(!stack.empty()) {
+		stack.pop_back();
+	}
+}
+
+
+// Function to measure the totals of the run, when it is finished
+void run_stats::finish() {
+	charge();
+	total_wall=last_wall-start_wall;
+	total_cpu=last_cpu-start_cpu;
+	process_cpu=process_cpu_ns()-process_cpu;
+	peak_rss=peak_rss_kb();
+}
+
+
+// Functions to set the counters of the run
+void run_stats::set_tokens(uint64_t n) {
+	num_tokens=n;
+}
+
+void run_stats::set_cycles(uint64_t n) {
+	num_cycles=n;
+}
+
+void run_stats::set_samples(uint64_t n) {
+	num_samples=n;
+}
+
+void run_stats::set_bytes(uint64_t n) {
+	num_bytes=n;
+}
+
+
+/**
+ * Function to report the statistics as a table, with a row for each phase
+ * @return the lines of the table
+ */
+string run_stats::get_table() {
+	ostringstream s;
+	s << left << setw(10) << "phase" << right << setw(12) << "wall ms"
+		<< setw(12) << "cpu ms" << setw(12) << "calls" << endl;
+	int64_t wall=0;
+	int64_t cpu=0;
+	for(int p=0; p<NUM_PHASES; p++) {
+		s << left << setw(10) << get_phase_name(p) << right
+			<< setw(12) << to_ms(wall_ns[p]) << setw(12) << to_ms(cpu_ns[p])
+			<< setw(12) << calls[p] << endl;
+		wall=wall+wall_ns[p];
+		cpu=cpu+cpu_ns[p];
+	}
+	s << left << setw(10) << "other" << right
+		<< setw(12) << to_ms(total_wall-wall) << setw(12)
+		<< to_ms(total_cpu-cpu) << endl;
+	s << left << setw(10) << "total" << right
+		<< setw(12) << to_ms(total_wall) << setw(12) << to_ms(total_cpu)
+		<< endl;
+	s << "CPU time of the process (ms): " << to_ms(process_cpu) << endl;
+	s << "Tokens: " << num_tokens << endl;
+	s << "Cycles: " << num_cycles << endl;
+	s << "Samples: " << num_samples << endl;
+	s << "Bytes written: " << num_bytes << endl;
+	s << "Peak RSS (KB): " << peak_rss << endl;
+	if(mem_stats::is_compiled_in()) {
+		s << mem_stats::get_table();
+	}
+	return s.str();
+}
+
+
+/**
+ * Function to report the statistics as a JSON object, on a single line
+ * Times are in nanoseconds
+ * @return the object
+ */
+string run_stats::get_json() {
+	ostringstream s;
+	s << "{\"phases\":{";
+	for(int p=0; p<NUM_PHASES; p++) {
+		s << (p ? "," : "") << "\"" << get_phase_name(p) << "\":{\"wall_ns\":"
+			<< wall_ns[p] << ",\"cpu_ns\":" << cpu_ns[p] << ",\"calls\":"
+			<< calls[p] << "}";
+	}
+	s << "},\"wall_ns\":" << total_wall << ",\"cpu_ns\":" << total_cpu
+		<< ",\"process_cpu_ns\":" << process_cpu
+		<< ",\"tokens\":" << num_tokens << ",\"cycles\":" << num_cycles
+		<< ",\"samples\":" << num_samples << ",\"bytes\":" << num_bytes
+		<< ",\"peak_rss_kb\":" << peak_rss;
+	if(mem_stats::is_compiled_in()) {
+		s << "," << mem_stats::get_json();
+	}
+	s << "}";
+	return s.str();
+}
+
+
+// Function to get the name of a phase
+const char *run_stats::get_phase_name(int p) {
+	static const char *const names[NUM_PHASES]={"read", "header", "signals",
+		"pattern", "macro", "call", "v", "shift", "w", "output"};
+	return names[p];
+}
+
+
+// Function to get the peak resident set size of the process, in KB
+uint64_t run_stats::peak_rss_kb() {
+	struct rusage ru;
+	getrusage(RUSAGE_SELF, &ru);
+	return ru.ru_maxrss;
+}
@@ -0,0 +1,137 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Timings and counters of the phases of a run (--stats)
+ * The time of each phase is exclusive of the phases that are entered from
+ * it: whilst a V of a Macro is executed, its time is charged to V, and not
+ * to the Macro nor to the Pattern block. The times of the phases thus add
+ * up to the time of the run. Wall time, and the CPU time of the thread that
+ * executes the run, are measured; the CPU time of worker threads is only
+ * part of the CPU time of the process.
+ */
+
+// Import Header files from the C++ STL
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "trace_events.h"
+
+#ifndef __RUN_STATS_H
+#define __RUN_STATS_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class run_stats {
+	public:
+		// Phases of a run
+		enum phase {
+			PHASE_READ,			// Read and tokenize the STIL file
+			PHASE_HEADER,		// process_header()
+			PHASE_SIGNALS,		// process_sig_grps()
+			PHASE_PATTERN,		// Pattern block, outside the phases below
+			PHASE_MACRO,		// Macro, outside its V, C and W
+			PHASE_CALL,			// Call of a procedure, outside its V and Shift
+			PHASE_V,			// V and C statements, outside Shift blocks
+			PHASE_SHIFT,		// Shift blocks, with their V
+			PHASE_W,			// W statements; a change of WaveformTable
+			PHASE_OUTPUT,		// Writing the output file
+			NUM_PHASES
+		};
+
+		/**
+		 * Guard that enters a phase for its scope; nothing is measured if
+		 * the statistics are NULL. The phase is also recorded on the
+		 * timeline, with an optional detail (such as the name of a Macro),
+		 * if the timeline is started (see trace_events.h).
+		 */
+		class scope {
+			public:
+				scope(run_stats *s, phase p, const char *detail=NULL)
+					: stats(s), recorded(trace_events::is_started()) {
+					if(stats != NULL) {
+						stats->enter(p);
+					}
+					if(recorded) {
+						trace_events::begin(get_phase_name(p), detail);
+					}
+				}
+				~scope() {
+					if(recorded) {
+						trace_events::end();
+					}
+					if(stats != NULL) {
+						stats->leave();
+					}
+				}
+
+			private:
+				run_stats *stats;
+				bool recorded;
+				// Copy constructor and assignment are not supported
+				scope(const scope &);
+				scope &operator=(const scope &);
+		};
+
+		// Standard Constructor; the run starts
+		run_stats();
+
+		// Define headers for functions...
+		// Enter a phase, from the current phase
+		void enter(phase p);
+		// Leave the current phase, back to the phase that entered it
+		void leave();
+		// The run is finished; its totals are measured
+		void finish();
+
+		// Counters of the run
+		void set_tokens(uint64_t n);
+		void set_cycles(uint64_t n);
+		void set_samples(uint64_t n);
+		void set_bytes(uint64_t n);
+
+		// Report as a table, or as a JSON object
+		string get_table();
+		string get_json();
+
+		// Name of a phase
+		static const char *get_phase_name(int p);
+		// Peak resident set size of the process, in KB
+		static uint64_t peak_rss_kb();
+
+
+	private:
+		// Declaration of instance variables...
+		// Exclusive wall and CPU time of each phase, in nanoseconds
+		int64_t wall_ns[NUM_PHASES];
+		int64_t cpu_ns[NUM_PHASES];
+		// Number of times that each phase is entered
+		uint64_t calls[NUM_PHASES];
+		// Phases that are entered; the top is the current phase
+		vector<int> stack;
+		// Clocks when the current phase was last charged
+		int64_t last_wall;
+		int64_t last_cpu;
+		// Totals of the run
+		int64_t start_wall;
+		int64_t start_cpu;
+		int64_t total_wall;
+		int64_t total_cpu;
+		int64_t process_cpu;
+		uint64_t num_tokens;
+		uint64_t num_cycles;
+		uint64_t num_samples;
+		uint64_t num_bytes;
+		uint64_t peak_rss;
+
+		// Charge the time since the last charge to the current phase
+		void charge();
+		// Copy constructor and assignment are not supported
+		run_stats(const run_stats &);
+		run_stats &operator=(const run_stats &);
+};
+#endif
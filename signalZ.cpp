@@ -28,15 +28,18 @@
 
 #include "signalZ.h"
 #include "file_analyzer.h"
+#include "pattern_pipeline.h"
+#include "trace.h"
+#include "mem_stats.h"
 
 #include "ViolatedAssertion.h"
 #include "ViolatedPostcondition.h"
 #include "ViolatedPrecondition.h"
 
 // List of waveform/timing properties of the signal...
-typedef list<signalZ::wave_prop> wp_list;
+typedef signalZ::wp_list wp_list;
 // Pointer to list of waveform/timing properties
-typedef list<signalZ::wave_prop>::iterator wp_l_p;
+typedef signalZ::wp_l_p wp_l_p;
 
 using namespace std;
 
@@ -51,6 +54,14 @@ signalZ::signalZ()
 	sig=UNDEFINED;
 	trigger=UNDEFINED;
 	sig_is_odd=true;
+	sig_period=0;
+	quantum_ps=file_analyzer::MEASURE_OF_TIME_PS;
+	last_val='\0';
+	num_drained=0;
+	selected=true;
+	fast_forward=false;
+	deferred=false;
+	pipeline=NULL;
 }
 
 // Standard constructor
@@ -59,6 +70,14 @@ signalZ::signalZ(string name) {
 	sig="";
 	trigger="";
 	sig_is_odd=true;
+	sig_period=0;
+	quantum_ps=file_analyzer::MEASURE_OF_TIME_PS;
+	last_val='\0';
+	num_drained=0;
+	selected=true;
+	fast_forward=false;
+	deferred=false;
+	pipeline=NULL;
 }
 
 // =======================================================================
@@ -120,6 +139,8 @@ const string signalZ::ZERO_ONE = string("01");
  * @return nothing
  */
 void signalZ::add_values(string s) {
+	MEM_SCOPE(MEM_VALUES);
+	expand_pending();
 	// Is this signal value a HASH?
 	if(s=="#") {
 		// Yes, check if this signal's condition is P?
@@ -147,6 +168,7 @@ void signalZ::add_values(string s) {
  * @deprecated
  */
 void signalZ::add_char(char c) {
+	expand_pending();
 	/**
 	 * The character "#" represents incremental parameter data replacement
 	 * in macros/procedures
@@ -166,14 +188,15 @@ void signalZ::add_char(char c) {
 
 /**
  * Function to append a string to the output file
- * @param current_ln is the current string to be appended as a line to
- *	the output file
+ * @param outputfile is the buffered output file, which is not flushed
+ *	by this line
  * @throws ViolatedAssertion exception when the signal's value or name is
  *	not properly initialized
  * @return nothing
  * O(1); COMPLETED
  */
-void signalZ::print_output_ln(ofstream &outputfile) {
+void signalZ::print_output_ln(output_buffer &outputfile) {
+	expand_pending();
 	if(sig_name==UNDEFINED) {
 		throw ViolatedAssertion("Signal's name is improperly initialized");
 	}
@@ -182,18 +205,29 @@ void signalZ::print_output_ln(ofstream &outputfile) {
 		throw ViolatedAssertion("Signal's value is improperly initialized");
 	}
 
-	// Left align the data in the output file
-	outputfile.setf(ios::left);
-	// Print its name...
+	// Print its name, left aligned...
+	outputfile.write(row_prefix());
+	// Print its value...
+	outputfile.write(sig);
+	outputfile.put('\n');
+}
+
+
+
+/**
+ * Function to obtain the start of the row of this signal in the table: its
+ * name, left aligned with tabs
+ * @return the name of the signal, followed by its tabs
+ * O(1); COMPLETED
+ */
+string signalZ::row_prefix() {
 	if((sig_name!=file_analyzer::MASTERCLK) && (sig_name!=file_analyzer::SCANOUT1)
 		&& (sig_name!=file_analyzer::SCANOUT2)) {
 
-		outputfile << sig_name << "\t\t";
+		return sig_name+"\t\t";
 	}else{
-		outputfile << sig_name << "\t";
+		return sig_name+"\t";
 	}
-	// Print its value...
-	outputfile << sig << endl;
 }
 
 
@@ -204,12 +238,136 @@ void signalZ::print_output_ln(ofstream &outputfile) {
  * @param w is the waveform/timing property that'll be added to this signal
  */
 void signalZ::add_wave_prop(wave_prop w) {
+	MEM_SCOPE(MEM_WAVE_PROPS);
+	expand_pending();
 	// Add the waveform/timing property to this signal
 	wpl.push_back(w);
 }
 
 
 
+/**
+ * Function to convert the character of a waveform event into its wave_event
+ * @param c is the character of the event, as found in the WaveformTable
+ * @return the wave_event of c; EVENT_INVALID if c is not an event
+ * O(1); COMPLETED
+ */
+signalZ::wave_event signalZ::to_event(char c) {
+	switch(c) {
+		case 'D':
+			return EVENT_D;
+		case 'U':
+			return EVENT_U;
+		case 'Z':
+			return EVENT_Z;
+		case 'P':
+			return EVENT_P;
+		case 'N':
+			return EVENT_N;
+		case 'L':
+			return EVENT_L;
+		case 'H':
+			return EVENT_H;
+		case 'X':
+			return EVENT_X;
+		case 'T':
+			return EVENT_T;
+		default:
+			return EVENT_INVALID;
+	}
+}
+
+
+
+/**
+ * Function to convert a wave_event into its character
+ * @param e is the wave_event
+ * @return the character of the event; '?' if e is not an event
+ * O(1); COMPLETED
+ */
+char signalZ::event_char(unsigned char e) {
+	// Characters of the events, in the order of the enum wave_event
+	static const char event_chars[] = "DUZPNLHXT";
+
+	if(e >= EVENT_INVALID) {
+		return '?';
+	}
+	return event_chars[e];
+}
+
+
+
+/**
+ * Function to convert the character of a value of the signal into its
+ * LOGIC_* code
+ * Drive and compare states share a code: "0" and "L" are logic zero, "1"
+ * and "H" are logic one, and "Z" and "T" are at high impedance. Any other
+ * character is unknown: a waveform character, such as "U" or "D", is only
+ * given a level by its WaveformTable, and an unknown clock value ("U") is
+ * unknown, as in clk_waveform()
+ * @param c is the character of the value
+ * @return the LOGIC_* code of the value; LOGIC_UNDEFINED if it is unknown
+ * O(1); COMPLETED
+ */
+int signalZ::logic_code(char c) {
+	switch(c) {
+		case '0':
+		case 'L':
+			return LOGIC_ZERO;
+		case '1':
+		case 'H':
+			return LOGIC_ONE;
+		case 'Z':
+		case 'T':
+			return LOGIC_HIGH_IMPEDANCE;
+		default:
+			return LOGIC_UNDEFINED;
+	}
+}
+
+
+
+/**
+ * Function to compile a waveform property from the events at an edge
+ * @param time is the time of the edge in picoseconds
+ * @param events is the list of alternative events; i.e., "D/U" or "X"
+ * @throws ViolatedAssertion exception if an event is invalid, or if there
+ *	are too many alternative events for this edge
+ * @return the compiled waveform property
+ * O(n); COMPLETED
+ */
+signalZ::wave_prop signalZ::make_wave_prop(int64_t time, string events) {
+	// Waveform property to be compiled
+	wave_prop w;
+	w.time=time;
+	w.num_events=0;
+
+	// For each character in the list of events...
+	for(int i=0; i<events.size(); i++) {
+		// Skip the separators of the alternative events
+		if(events[i] == '/') {
+			continue;
+		}
+
+		if(w.num_events >= MAX_EVENTS_PER_EDGE) {
+			throw ViolatedAssertion("Too many events are defined for an edge");
+		}
+
+		// Convert the event...
+		wave_event e = to_event(events[i]);
+		if(e == EVENT_INVALID) {
+			cerr<<"Event of waveform is:"<<events<<"<:::"<<endl;
+			throw ViolatedAssertion("Event of waveform is invalid");
+		}
+		w.events[w.num_events]=(unsigned char)e;
+		w.num_events++;
+	}
+
+	return w;
+}
+
+
+
 /**
  * Function to return the triggering condition of this signal
  */
@@ -288,10 +446,10 @@ void signalZ::set_condition(string c) {
 	
 	// If the last character of the pattern is not alphanumeric
 	if(!isalnum(c[c.size()-1])) {
-cout<<"c is:"<<c<<">:::"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "c is:"<<c<<">:::");
 		// Drop the last character, which is not alphanumeric
 		c.erase(c.size()-1,1);
-cout<<"c IS NOw::"<<c<<"<:::"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "c IS NOw::"<<c<<"<:::");
 	}
 
 
@@ -316,14 +474,14 @@ string signalZ::get_condition() {
  *	Else, return false
  */
 bool signalZ::condition_met() {
-cout<<"COndition pre-if statement"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "COndition pre-if statement");
 	// If the current value meets the condition...
 	if((sig_condition==current_condition()) || (sig_condition==X)) {
-cout<<"conditions are met"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "conditions are met");
 		// Condition is met; resume operation...
 		return true;
 	}else{
-cout<<"conditions are NOT met"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "conditions are NOT met");
 		// Else, condition is not met
 		return false;
 	}
@@ -336,10 +494,14 @@ cout<<"conditions are NOT met"<<endl;
  *	value
  */
 string signalZ::current_condition() {
+	expand_pending();
 	// Are the signal values present?
 	if(sig.size()>0) {
 		// Yes
 		return sig.substr(sig.size()-1,1);
+	}else if(last_val != '\0') {
+		// The values have been drained; use the most recent value
+		return string(1,last_val);
 	}else{
 		// No
 		return "";
@@ -354,13 +516,14 @@ string signalZ::current_condition() {
  * @return nothing
  */
 void signalZ::add_sig_patterns(string s) {
-cout<<"s is THIS!!!"<<s<<"::::"<<endl;
+	MEM_SCOPE(MEM_PATTERNS);
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "s is THIS!!!"<<s<<"::::");
 	// If the last character of the pattern is alphanumeric
 	if(!isalnum(s[s.size()-1])) {
-cout<<"s is:"<<s<<">:::"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "s is:"<<s<<">:::");
 		// Drop the last character, which is not alphanumeric
 		s.erase(s.size()-1,1);
-cout<<"s IS NOw::"<<s<<"<:::"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "s IS NOw::"<<s<<"<:::");
 	}
 
 	s_p.push_back(s);
@@ -373,7 +536,7 @@ cout<<"s IS NOw::"<<s<<"<:::"<<endl;
  * @return true if the condition is "P"; else, return false.
  */
 bool signalZ::is_condition_p() {
-cout<<"condition is P???"<< sig_condition <<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "condition is P???"<< sig_condition);
 	return (get_condition()==P);
 }
 
@@ -414,12 +577,160 @@ string signalZ::get_last_pattern() {
 }
 
 
-// Obtain the values of the signal vector
-string signalZ::get_sig_values() {
+/**
+ * Function to obtain the values of the signal vector
+ * Values that are queued are not expanded; only the stages of the pipeline
+ * are waited for, if any
+ * @return the values of the signal
+ */
+const string &signalZ::get_sig_values() {
+	if(pipeline != NULL) {
+		pipeline->sync();
+	}
 	return sig;
 }
 
 
+// Number of values of the signal, including the values that are not held
+uint64_t signalZ::get_num_samples() {
+	expand_pending();
+	return num_expanded();
+}
+
+
+/**
+ * Function to select whether the values of the signal are stored
+ * An unselected signal only keeps track of its state: its most recent
+ * value, and its number of values. Its values are never stored, or written
+ * to the output file.
+ * @param s is true if the values of the signal are to be stored
+ * @return nothing
+ */
+void signalZ::set_selected(bool s) {
+	expand_pending();
+	selected=s;
+}
+
+
+// Is the signal selected?
+bool signalZ::is_selected() {
+	return selected;
+}
+
+
+/**
+ * Function to fast-forward the signal through the cycles that precede a
+ * slice of the pattern
+ * Whilst fast-forwarding, only the state of the signal is kept, as for an
+ * unselected signal. Values are counted from the end of the fast-forward,
+ * which is the start of the slice.
+ * @param f is true if the signal is fast-forwarded
+ * @return nothing
+ */
+void signalZ::set_fast_forward(bool f) {
+	expand_pending();
+	if(fast_forward && (!f)) {
+		// No value has been stored whilst fast-forwarding
+		num_drained=0;
+	}
+	fast_forward=f;
+}
+
+
+// Are the emitted values stored?
+bool signalZ::stores_values() {
+	return selected && (!fast_forward);
+}
+
+
+/**
+ * Function to emit a value of the signal, for a quantum of time
+ * All values that are expanded from the waveforms are emitted here
+ * @param c is the value
+ * @return nothing
+ * O(1); COMPLETED
+ */
+void signalZ::emit(char c) {
+	if(stores_values()) {
+		sig += c;
+	}else{
+		// Only the state of the signal is kept
+		last_val=c;
+		num_drained++;
+	}
+}
+
+
+/**
+ * Function to emit the same value of the signal, for n quanta of time
+ * @param c is the value
+ * @param n is the number of quanta of time
+ * @return nothing
+ * O(n) computational time complexity if the signal is selected; else, O(1)
+ */
+void signalZ::emit_run(char c, uint64_t n) {
+	if(n == 0) {
+		return;
+	}
+	if(stores_values()) {
+		sig.append(n, c);
+	}else{
+		last_val=c;
+		num_drained=num_drained+n;
+	}
+}
+
+
+/**
+ * Function to emit a sequence of values of the signal
+ * @param s is the sequence of values, one for each quantum of time
+ * @return nothing
+ */
+void signalZ::emit_string(const string &s) {
+	if(s.empty()) {
+		return;
+	}
+	if(stores_values()) {
+		sig += s;
+	}else{
+		last_val=s[s.size()-1];
+		num_drained=num_drained+s.size();
+	}
+}
+
+
+/**
+ * Function to obtain the number of quanta of time in the period of the
+ * signal; the last quantum may be partial
+ * @return the number of quanta of time
+ */
+uint64_t signalZ::num_intervals() {
+	if(get_sig_period() <= 0) {
+		return 0;
+	}
+	return (get_sig_period()+quantum_ps-1) / quantum_ps;
+}
+
+
+/**
+ * Function to write the values that have been expanded since the last drain
+ * to the output file, and discard them
+ * The storage of the values is kept for the next cycle, so that the values
+ * of a signal only ever hold a single cycle whilst streaming
+ * @param outputfile is the buffered output file
+ * @return nothing
+ */
+void signalZ::drain_values(output_buffer &outputfile) {
+	expand_pending();
+	if(sig.size() > 0) {
+		outputfile.write(sig);
+		last_val=sig[sig.size()-1];
+		num_drained=num_drained+sig.size();
+		sig.clear();
+	}
+}
+
+
 // Get the number of assigned signal patterns to this signal vector
 int signalZ::get_num_patterns() {
 	return s_p.size();
@@ -455,7 +766,7 @@ void signalZ::convert_wave_prop() {
 			 */
 			 
 //			for(int i=0; i<file_analyzer::period_t; i+=file_analyzer::MEASURE_OF_TIME) {
-			for(int i=0; i<sig_period; i+=file_analyzer::MEASURE_OF_TIME) {
+			for(int64_t i=0; i<sig_period; i+=quantum_ps) {
 				// For this time interval, add its pattern value
 				sig = sig + last_pattern[j];
 			}
@@ -464,32 +775,51 @@ void signalZ::convert_wave_prop() {
 }
 
 
-// Get the period of the signal
-int signalZ::get_sig_period() {
+// Get the period of the signal in picoseconds
+int64_t signalZ::get_sig_period() {
 	return sig_period;
 }
 
 
 
-// Set the period of the signal; @param i is the period
-void signalZ::set_sig_period(int i) {
+// Set the period of the signal; @param i is the period in picoseconds
+void signalZ::set_sig_period(int64_t i) {
+	// The queued values are expanded with the period that they were set with
+	if(i == sig_period) {
+		return;
+	}
+	expand_pending();
 	sig_period=i;
 }
 
 
 
+/**
+ * Function to set the quantization unit of time of the values of the
+ * signal; it is set before any value is added
+ * @param ps is the unit of time in picoseconds
+ * @throws ViolatedPrecondition exception if it is not positive
+ * @return nothing
+ */
+void signalZ::set_quantum(int64_t ps) {
+	if(ps <= 0) {
+		throw ViolatedPrecondition("Quantum of time must be positive");
+	}
+	quantum_ps=ps;
+}
+
+
+
 /**
  * Function to process the waveform of the signal for a clock cycle
  * @param logic is the value of the signal for the clock cycle
  */
-void signalZ::sig_waveform(string logic) {
+void signalZ::sig_waveform(char logic) {
 	// Is its condition equal to "P"
-	if((logic==HASH) && (get_num_patterns()>0)) {
-cout<<"The logic is PPPPPPPPPPPPPPPPPPPPPP:"<<endl;
-		sig = sig + get_last_pattern();
-cout<<"Val of sig:"<<sig<<"::"<<endl;
+	if((logic=='#') && (get_num_patterns()>0)) {
+		emit_string(get_last_pattern());
 		return;
-	}else if((logic==HASH) && (get_num_patterns()<=0)) {
+	}else if((logic=='#') && (get_num_patterns()<=0)) {
 		return;
 	}
 
@@ -517,14 +847,9 @@ cout<<"Val of sig:"<<sig<<"::"<<endl;
 	 * divisor)
 	 * That is, number of intervals = clock period / length of timing interval
 	 */
-cout<<"The period is:"<<get_sig_period()<<":::"<<endl;
 	// For each time interval in the clock period
-	for(int a=0; a<get_sig_period(); a+=file_analyzer::MEASURE_OF_TIME) {
-		// Append the logic value of to the signal vector
-		sig = sig + logic;
-//cout<<"incrementing SIG:"<<sig<<":::"<<endl;
-	}
-cout<<"val of SIG:"<<sig<<":::"<<endl;
+	// Append the logic value to the signal vector, once for each interval
+	emit_run(logic, num_intervals());
 }
 
 
@@ -538,7 +863,7 @@ cout<<"val of SIG:"<<sig<<":::"<<endl;
  * I have chosen that over ground, since I can load a clock period as opposed
  * to a grounded logic value for a clock period
  */
-void signalZ::clk_waveform(string logic) {
+void signalZ::clk_waveform(char logic) {
 	// If this clock has no waveform properties...
 	if(wpl.size() < 1) {
 		// It cannot be a clock...
@@ -546,57 +871,42 @@ void signalZ::clk_waveform(string logic) {
 		throw ViolatedAssertion("Clock has missing waveform properties.");
 	}
 
-	// Current logic value of the signal...
-	string current_val="";
-
 	// Enumerate the waveform properties...
 	wp_l_p wpp = wpl.begin();
 	
 	// If the waveform properties for this clock does not start at time 0...
-	if((*wpp).time != ZERO) {
+	if((*wpp).time != 0) {
 		// Waveform properties of the clock are invalid...
 		cerr << "Clock signal name is:"<< get_name()<<"<:::"<< endl;
 		throw ViolatedAssertion("Clock has invalid waveform properties.");
 	}	
 
 	// For each time interval in the clock period
-	for(int a=0; a<get_sig_period(); a+=file_analyzer::MEASURE_OF_TIME) {
+	for(int64_t a=0; a<get_sig_period(); a+=quantum_ps) {
 		// Is this signal value HIGH?
-		if((logic == H) || (logic == ONE)) {
+		if((logic == 'H') || (logic == '1')) {
 			/**
 			 * Process the values of this clock signal according to its
 			 * waveform properties
+			 *
+			 * If this time checkpoint is not reached, and there is another
+			 * waveform property to proceed to...
 			 */
-			
-			
-			/**
-			 * Cumbersome workaround for a compiling error regarding the
-			 * conversion from a string to a C string, which is a character
-			 * sequence 
-			 */
-			current_val=(*wpp).time;
-
-			// If this time checkpoint is not reached...
-			if((a<atoi(current_val.c_str())) && (wpp != wpl.end())) {
+			if((a<(*wpp).time) && ((wpp+1) != wpl.end())) {
 				// Proceed to the next available waveform property
 				wpp++;
 				
 				/**
-				 * If the logic value for this waveform property is high
-				 * or don't care
+				 * If the event for this waveform property is a logic high
 				 */
-				if(((*wpp).logic_val == H) || ((*wpp).logic_val == ONE)) {
+				if((*wpp).events[0] == EVENT_H) {
 					
 					// Append a high logic value to the signal vector
-cout<<"Value of SiGNAL before adding ONE:"<<sig<<">>>"<<endl;
-					sig = sig + ONE;
-cout<<"Value of SiGNAL:"<<sig<<">>>"<<endl;
+					emit('1');
 				// Is the logic value unknown?
-				}else if((*wpp).logic_val == U) {
+				}else if((*wpp).events[0] == EVENT_U) {
 					// Yes, append a logic unknown value to it
-cout<<"Value of SiGNAL before adding Z:"<<sig<<">>>"<<endl;
-					sig = sig + Z;
-cout<<"Value of SiGNAL:"<<sig<<">>>"<<endl;
+					emit('Z');
 				}else{
 					/**
 					 * Append a logic LOW value to the signal vector
@@ -604,23 +914,19 @@ cout<<"Value of SiGNAL:"<<sig<<">>>"<<endl;
 					 * high, low, unknown, or don't-care, assume that it will
 					 * be treated as a logic low by default
 					 */
-cout<<"Value of SiGNAL before adding ZERO:"<<sig<<">>>"<<endl;
-					sig = sig + ZERO;
-cout<<"Value of SiGNAL:"<<sig<<">>>"<<endl;
+					emit('0');
 				}
 			}else{
 				/**
 				 * The last timing checkpoint has been defined...
 				 * Append logic high values to the signal
 				 */
-cout<<"Timing properties of signal have been defined:"<<sig<<">>>"<<endl;
-				sig = sig + ONE;
-cout<<"New Value of SiGNAL:"<<sig<<">>>"<<endl;
+				emit('1');
 			}
 			
 			
-		}else if((logic == L) || (logic == ZERO)
-			|| (logic == X) || (logic == U)) {
+		}else if((logic == 'L') || (logic == '0')
+			|| (logic == 'X') || (logic == 'U')) {
 			
 			/**
 			 * Else, the value for this signal is either a logic LOW, in high
@@ -631,9 +937,7 @@ cout<<"New Value of SiGNAL:"<<sig<<">>>"<<endl;
 			 */
 
 			// Append the logic value of to the signal vector
-cout<<"Value of SiGNAL is ZERO/U/X:"<<sig<<">>>"<<endl;
-			sig = sig + logic;
-cout<<"LOW Value of SiGNAL:"<<sig<<">>>"<<endl;
+			emit(logic);
 		}else{
 			// Logic value for the signal is in appropriate... Report error!
 			cerr<<"Signal name is:"<<get_name()<<", and its logic value is:";
@@ -652,18 +956,40 @@ cout<<"LOW Value of SiGNAL:"<<sig<<">>>"<<endl;
  * @return nothing
  */
 void signalZ::sig_vector(string logic) {
+	MEM_SCOPE(MEM_VALUES);
 	// Is this a hash character?
 	if((logic != HASH) && (!isalnum(logic[logic.size()-1])) ) {
-cout<<"logic is:"<<logic<<">:::"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "logic is:"<<logic<<">:::");
 		// Drop the last character, which is not alphanumeric
 		logic.erase(logic.size()-1,1);
-cout<<"logic IS NOw::"<<logic<<"<:::"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "logic IS NOw::"<<logic<<"<:::");
+	}
+	// Are the values expanded later, with those of other vectors?
+	if(deferred) {
+		if(is_clk() || (logic.find('#') == string::npos)) {
+			pending_values.append(logic);
+			return;
+		}
+		/**
+		 * Each "#" takes its pattern now, in the order of the vectors;
+		 * a "#" without a pattern has no values
+		 */
+		for(int a=0; a<logic.size(); a++) {
+			if(logic[a] != '#') {
+				pending_values.push_back(logic[a]);
+			}else if(!s_p.empty()) {
+				MEM_SCOPE(MEM_PATTERNS);
+				pending_values.push_back('#');
+				pending_patterns.push_back(get_last_pattern());
+			}
+		}
+		return;
 	}
 
 
 	// Current enumerated value of the signal
-	string current_sig_val="";
-cout<<"Logic Val of Sig:::"<<logic<<":::"<<endl;
+	char current_sig_val;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "Logic Val of Sig:::"<<logic<<":::");
 	// For each signal value in the signal vector
 	for(int a=0; a<logic.size(); a++) {
 		// Process this current signal value
@@ -672,7 +998,7 @@ cout<<"Logic Val of Sig:::"<<logic<<":::"<<endl;
 		 * Assign the signal value to a temp variable
 		 * Note that the signal value is always a single character
 		 */
-		current_sig_val = logic.substr(a,1);
+		current_sig_val = logic[a];
 		
 		// Is this a clock signal?
 		if(is_clk()) {
@@ -680,18 +1006,136 @@ cout<<"Logic Val of Sig:::"<<logic<<":::"<<endl;
 			 * Yes, process its clock waveform according to its waveform
 			 * properties
 			 */
-cout<<"Set the val for clock:"<<current_sig_val<<">>>"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "Set the val for clock:"<<current_sig_val<<">>>");
 			clk_waveform(current_sig_val);
 		}else{
 			/**
 			 * This signal is not a clock signal... Process this non-clock
 			 * signal accordingly
 			 */
-cout<<"Set the val for signal:"<<current_sig_val<<">>>"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "Set the val for signal:"<<current_sig_val<<">>>");
 			sig_waveform(current_sig_val);
 		}
 	}
-cout<<"------------------------------SigVecTOr: Has been processed"<<endl;
+TRACE(TRACE_VALUES, TRACE_VERBOSE, "------------------------------SigVecTOr: Has been processed");
+}
+
+
+
+/**
+ * Function to defer the expansion of the values of the signal
+ * Whilst deferred, sig_vector() only queues the waveform characters of the
+ * vector. The queue is expanded by expand_pending(), or before the state of
+ * the signal that the expansion depends upon (waveforms, period, patterns,
+ * selection) is changed.
+ * @param d is true if the expansion is deferred
+ * @return nothing
+ */
+void signalZ::set_deferred(bool d) {
+	if(!d) {
+		expand_pending();
+	}
+	deferred=d;
+}
+
+
+/**
+ * Function to expand the queued waveform characters into values
+ * Signals are independent of each other, so that different signals may be
+ * expanded on different threads at the same time
+ * @return nothing
+ * O(n) computational time complexity, for n values
+ */
+void signalZ::expand_pending() {
+	// The values in the pipeline precede those of the queue
+	if(pipeline != NULL) {
+		pipeline->sync();
+	}
+	if(pending_values.empty()) {
+		return;
+	}
+	string values;
+	str_list patterns;
+	take_pending(values, patterns);
+	expand_values(values, 0, values.size(), patterns);
+}
+
+
+// Number of waveform characters that are queued for expansion
+size_t signalZ::num_pending() {
+	return pending_values.size();
+}
+
+
+// Function to set the pipeline that expands the values of the signal
+void signalZ::set_pipeline(pattern_pipeline *p) {
+	pipeline=p;
+}
+
+
+/**
+ * Function to take the queued waveform characters, and the patterns of
+ * their "#" characters, to be expanded elsewhere
+ * @param values is appended the waveform characters
+ * @param patterns is appended the patterns
+ * @return nothing
+ */
+void signalZ::take_pending(string &values, str_list &patterns) {
+	values.append(pending_values);
+	pending_values.clear();
+	patterns.splice(patterns.end(), pending_patterns);
+}
+
+
+/**
+ * Function to expand waveform characters into values
+ * A "#" character is expanded into the next of the patterns
+ * @param values is the waveform characters
+ * @param first is the index of the first character that is expanded
+ * @param last is the index after the last character that is expanded
+ * @param patterns is the patterns of the "#" characters; each is removed
+ *	once it is expanded
+ * @return nothing
+ * O(n) computational time complexity, for n values
+ */
+void signalZ::expand_values(const string &values, size_t first, size_t last,
+	str_list &patterns) {
+
+	MEM_SCOPE(MEM_VALUES);
+	bool clk=is_clk();
+	for(size_t a=first; a<last; a++) {
+		if(clk) {
+			clk_waveform(values[a]);
+		}else if((values[a] == '#') && (!patterns.empty())) {
+			emit_string(patterns.front());
+			patterns.pop_front();
+		}else{
+			sig_waveform(values[a]);
+		}
+	}
+}
+
+
+/**
+ * Function to append the values that have been expanded since they were
+ * last taken to a row, and discard them; see drain_values()
+ * @param row is appended the values
+ * @return nothing
+ */
+void signalZ::take_values(string &row) {
+	MEM_SCOPE(MEM_OUTPUT);
+	if(sig.size() > 0) {
+		row.append(sig);
+		last_val=sig[sig.size()-1];
+		num_drained=num_drained+sig.size();
+		sig.clear();
+	}
+}
+
+
+// Number of values that have been expanded, including those not held
+uint64_t signalZ::num_expanded() {
+	return num_drained+sig.size();
 }
 
 
@@ -701,6 +1145,7 @@ cout<<"------------------------------SigVecTOr: Has been processed"<<endl;
  * signal waveform is loaded into it
  */
 void signalZ::clr_waveform_properties() {
+	expand_pending();
 	wpl.clear();
 }
 
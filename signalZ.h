@@ -19,9 +19,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <list>
+#include <vector>
 #include <iterator>
+#include <stdint.h>
 
 
+#include "output_buffer.h"
+
+class pattern_pipeline;
+
 #ifndef __SIGNAL_H
 #define __SIGNAL_H
 using namespace std;
@@ -29,8 +35,8 @@ using namespace std;
 
 // List of strings
 typedef list<string> str_list;
-// Pointer to list of strings
-typedef list<string>::iterator str_l_p;
+// Pointer to list of strings; the tokens of a compiled file are read-only
+typedef list<string>::const_iterator str_l_p;
 
 
 // =======================================================================
@@ -77,19 +83,66 @@ class signalZ {
 		void add_values(string s);
 		void add_char(char c);
 		string get_name();
-		void print_output_ln(ofstream &outputfile);
+		void print_output_ln(output_buffer &outputfile);
+		// Name of the signal, left aligned with tabs, at the start of its row
+		string row_prefix();
 		
 		
-		// Declare data structure to contain its waveform properties
+		/**
+		 * Events that a waveform can take at each of its edges
+		 * Each event is parsed once, when the WaveformTable is compiled;
+		 * no string comparison is made whilst the signals are expanded
+		 */
+		enum wave_event {
+			EVENT_D,		// Force down
+			EVENT_U,		// Force up
+			EVENT_Z,		// Force off (high impedance)
+			EVENT_P,		// Force prior
+			EVENT_N,		// Force unknown
+			EVENT_L,		// Compare low
+			EVENT_H,		// Compare high
+			EVENT_X,		// Compare unknown/don't-care
+			EVENT_T,		// Compare off (high impedance)
+			EVENT_INVALID
+		};
+		/**
+		 * Maximum number of alternative events at an edge; i.e., "X/H/L"
+		 * Alternatives are selected by the index of the waveform character
+		 */
+		static const int MAX_EVENTS_PER_EDGE = 6;
+		// Number of picoseconds in each unit of time (UNIT_OF_TIME)
+		static const int64_t PS_PER_UNIT_OF_TIME = 1000;
+
+		/**
+		 * Declare data structure to contain its waveform properties
+		 * The time of the edge is kept in picoseconds; four of these
+		 * properties fit in a cache line
+		 */
 		struct wave_prop {
-			string time;
-			string logic_val;
+			// Time of the edge in picoseconds
+			int64_t time;
+			// Number of alternative events at this edge
+			unsigned char num_events;
+			// Alternative events at this edge; of the type wave_event
+			unsigned char events[MAX_EVENTS_PER_EDGE];
 		};
 		
 		// List of waveform/timing properties of the signal...
-		typedef list<wave_prop> wp_list;
+		typedef vector<wave_prop> wp_list;
 		// Pointer to list of waveform/timing properties
-		typedef list<wave_prop>::iterator wp_l_p;
+		typedef vector<wave_prop>::iterator wp_l_p;
+
+		// Convert the character of an event into its wave_event
+		static wave_event to_event(char c);
+		// Convert a wave_event into its character
+		static char event_char(unsigned char e);
+		// Convert the character of a value into its LOGIC_* code
+		static int logic_code(char c);
+		/**
+		 * Compile the waveform property at "time" picoseconds, with the
+		 * events (i.e., "D/U") given as a string
+		 */
+		static wave_prop make_wave_prop(int64_t time, string events);
 
 
 		// Add the waveform/timing properties of the signal to the list of signals
@@ -123,7 +176,52 @@ class signalZ {
 		string get_last_pattern();
 		
 		// Obtain the values of the signal vector
-		string get_sig_values();
+		const string &get_sig_values();
+		// Number of values of the signal, including values that are not held
+		uint64_t get_num_samples();
+		// Select whether the values of the signal are stored
+		void set_selected(bool s);
+		bool is_selected();
+		/**
+		 * Fast-forward the signal: its state is kept, but its values are
+		 * not stored, whether it is selected or not
+		 */
+		void set_fast_forward(bool f);
+		/**
+		 * Defer the expansion of the values of the signal: the waveform
+		 * characters of its vectors are queued, and expanded together by
+		 * expand_pending(), possibly on another thread
+		 */
+		void set_deferred(bool d);
+		void expand_pending();
+		// Number of waveform characters that are queued for expansion
+		size_t num_pending();
+		/**
+		 * Hand the expansion over to the stages of a pipeline, which is
+		 * synchronized before the values or the state of the signal are
+		 * used; NULL to expand on this thread again
+		 */
+		void set_pipeline(pattern_pipeline *p);
+		/**
+		 * Functions of the stages of the pipeline, which neither expand the
+		 * queue nor synchronize with the pipeline:
+		 * Take the queued waveform characters, and the patterns of their
+		 * "#" characters
+		 */
+		void take_pending(string &values, str_list &patterns);
+		// Expand the waveform characters values[first, last)
+		void expand_values(const string &values, size_t first, size_t last,
+			str_list &patterns);
+		// Append the expanded values to a row, and discard them
+		void take_values(string &row);
+		// Number of values that have been expanded
+		uint64_t num_expanded();
+		/**
+		 * Write the values that have been expanded since the last drain to
+		 * the output file, and discard them; only the most recent value is
+		 * kept for the condition of the signal
+		 */
+		void drain_values(output_buffer &outputfile);
 		// Get the number of assigned signal patterns to this signal vector
 		int get_num_patterns();
 		// Get the assigned string patterns of this signal
@@ -133,23 +231,36 @@ class signalZ {
 		// Convert the waveform properties into signal values; Deprecated
 		void convert_wave_prop();
 		
-		// Get the period of the signal
-		int get_sig_period();
-		// Set the period of the signal
-		void set_sig_period(int i);
+		// Get the period of the signal in picoseconds
+		int64_t get_sig_period();
+		// Set the period of the signal in picoseconds
+		void set_sig_period(int64_t i);
+		// Set the quantization unit of time of the values, in picoseconds
+		void set_quantum(int64_t ps);
 		/**
 		 * Additional functions to handle waveform properties and logic values
 		 * for the clock
 		 */
-		void clk_waveform(string logic);
+		void clk_waveform(char logic);
 		void sig_vector(string logic);
-		void sig_waveform(string logic);
+		void sig_waveform(char logic);
 		/**
 		 * Clear the waveform properties of this signal as another clock signal waveform
 		 * is loaded into it
 		 */
 		void clr_waveform_properties();
 		bool is_clk();
+
+
+	protected:
+		// Emit values of the signal; see set_selected() and set_fast_forward()
+		void emit(char c);
+		void emit_run(char c, uint64_t n);
+		void emit_string(const string &s);
+		// Are the emitted values stored?
+		bool stores_values();
+		// Number of quanta of time in the period of the signal
+		uint64_t num_intervals();
 		
 		
 	private:
@@ -158,6 +269,21 @@ class signalZ {
 		string sig_name;
 		// Values of signal
 		string sig;
+		// Most recent value of the signal, once its values have been drained
+		char last_val;
+		// Number of values that are not held in sig: drained, or not stored
+		uint64_t num_drained;
+		// Are the values of the signal stored? Else, only its state is kept
+		bool selected;
+		// Are the cycles before a slice of the pattern being executed?
+		bool fast_forward;
+		// Is the expansion deferred? Waveform characters to be expanded
+		bool deferred;
+		string pending_values;
+		// Patterns of the queued "#" characters, which are taken when queued
+		str_list pending_patterns;
+		// Pipeline that expands the values of the signal; NULL if none
+		pattern_pipeline *pipeline;
 		// Triggering condition of the signal
 		string trigger;
 
@@ -181,7 +307,9 @@ class signalZ {
 		string sig_condition;
 		// List of signal patterns
 		str_list s_p;
-		// Period of the signal
-		int sig_period;
+		// Period of the signal in picoseconds
+		int64_t sig_period;
+		// Quantization unit of time of the values, in picoseconds
+		int64_t quantum_ps;
 };
 #endif
\ No newline at end of file
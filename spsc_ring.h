@@ -0,0 +1,106 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Bounded ring buffer between a single producer thread and a single
+ * consumer thread, without locks
+ * The producer only writes the tail, and the consumer only writes the head;
+ * each publishes its index with a release store, which the other reads with
+ * an acquire load. A full ring stalls the producer, and an empty ring stalls
+ * the consumer, so that the stages of a pipeline run at the rate of the
+ * slowest stage, with a bounded amount of work in flight.
+ */
+
+// Import Header files from the C++ STL
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <stddef.h>
+
+#include "trace_events.h"
+
+
+#ifndef __SPSC_RING_H
+#define __SPSC_RING_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+template <class T>
+class spsc_ring {
+	public:
+		// Standard Constructor; the capacity is rounded up to a power of 2
+		spsc_ring(size_t capacity) : head(0), tail(0), closed(false) {
+			size_t n=2;
+			while(n < capacity) {
+				n=n*2;
+			}
+			slots.resize(n);
+			mask=n-1;
+		}
+
+		/**
+		 * Append an item; the producer waits whilst the ring is full
+		 * @param item is the item; it is moved into the ring
+		 * @return nothing
+		 */
+		void push(T &item) {
+			size_t t=tail.load(memory_order_relaxed);
+			if((t-head.load(memory_order_acquire)) > mask) {
+				trace_events::scope stall("ring full");
+				while((t-head.load(memory_order_acquire)) > mask) {
+					this_thread::yield();
+				}
+			}
+			slots[t&mask]=std::move(item);
+			tail.store(t+1, memory_order_release);
+		}
+
+		/**
+		 * Take the oldest item; the consumer waits whilst the ring is empty
+		 * and not closed
+		 * @param item is assigned the item
+		 * @return true if an item is taken; false if the ring is closed and
+		 *	empty
+		 */
+		bool pop(T &item) {
+			size_t h=head.load(memory_order_relaxed);
+			if(h == tail.load(memory_order_acquire)) {
+				trace_events::scope stall("ring empty");
+				while(h == tail.load(memory_order_acquire)) {
+					if(closed.load(memory_order_acquire)
+						&& (h == tail.load(memory_order_acquire))) {
+
+						return false;
+					}
+					this_thread::yield();
+				}
+			}
+			item=std::move(slots[h&mask]);
+			head.store(h+1, memory_order_release);
+			return true;
+		}
+
+		// No item is pushed after this; called by the producer
+		void close() {
+			closed.store(true, memory_order_release);
+		}
+
+
+	private:
+		// Declaration of instance variables...
+		vector<T> slots;
+		size_t mask;
+		// Index of the next item to be taken, and to be appended
+		alignas(64) atomic<size_t> head;
+		alignas(64) atomic<size_t> tail;
+		// Has the producer finished?
+		atomic<bool> closed;
+
+		// Copy constructor and assignment are not supported
+		spsc_ring(const spsc_ring &);
+		spsc_ring &operator=(const spsc_ring &);
+};
+#endif
@@ -0,0 +1,285 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Cache of executed STIL files; see stil_cache.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #A file is executed without holding the lock of the cache, so that the
+ *	other files are still answered in the meantime; if two requests execute
+ *	the same file at the same time, the first one to finish is cached
+ * #The file that has just been cached is never evicted, even if it exceeds
+ *	the budget on its own
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "stil_cache.h"
+#include "compiled_stil.h"
+#include "file_analyzer.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// =======================================================================
+
+// Standard constructor
+stil_cache::stil_cache(uint64_t budget) {
+	budget_bytes=budget;
+	used_bytes=0;
+	hits=0;
+	misses=0;
+	evictions=0;
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to get the values of a signal over a range of cycles
+ * @param i is the index of the signal
+ * @param first is the first cycle
+ * @param last is the cycle after the range; it is clipped to the end of
+ *	the pattern
+ * @return the values of the signal in the cycles
+ */
+string stil_cache::cached_file::get_values(size_t i, long long first,
+	long long last) const {
+
+	if(last > num_cycles) {
+		last=num_cycles;
+	}
+	if((first < 0) || (first >= last)) {
+		return "";
+	}
+	uint64_t start=get_offset(i, first);
+	return values[i].substr(start, get_offset(i, last)-start);
+}
+
+
+/**
+ * Function to get the offset of the values of a signal at the start of a
+ * cycle
+ * The offset is recomputed from the checkpoint at the start of the block
+ * of the cycle, and the shapes of the cycles before it in the block
+ * @param i is the index of the signal
+ * @param cycle is the cycle; num_cycles for the end of the last cycle
+ * @return the offset of its values in the values of the signal
+ * O(CHECKPOINT_STRIDE) computational time complexity
+ */
+uint64_t stil_cache::cached_file::get_offset(size_t i, long long cycle) const {
+	size_t n=names.size();
+	long long block=cycle/CHECKPOINT_STRIDE;
+	uint64_t offset=checkpoints[block*n+i];
+	for(long long c=block*CHECKPOINT_STRIDE; c<cycle; c++) {
+		offset=offset+shapes[cycle_shapes[c]*n+i];
+	}
+	return offset;
+}
+
+
+/**
+ * Function to get the number of values of a signal in a cycle
+ * @param i is the index of the signal
+ * @param cycle is the cycle
+ * @return the number of values
+ * O(1) computational time complexity
+ */
+uint32_t stil_cache::cached_file::get_count(size_t i, long long cycle) const {
+	return shapes[cycle_shapes[cycle]*names.size()+i];
+}
+
+
+// Function to find a signal by its name; -1 if there is none
+int stil_cache::cached_file::find_signal(string name) const {
+	for(size_t i=0; i<names.size(); i++) {
+		if(names[i] == name) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+
+/**
+ * Function to get an executed file
+ * The file is executed if it is not cached, or if it has changed since it
+ * was cached; it then becomes the most recently used file
+ * @param path is the name of the STIL file
+ * @throws ViolatedPrecondition exception if it does not exist
+ * @throws the exception that was thrown whilst it was executed
+ * @return the executed file
+ */
+shared_ptr<const stil_cache::cached_file> stil_cache::get(string path) {
+	// Files are cached by their canonical names
+	char resolved[PATH_MAX];
+	struct stat st;
+	if((realpath(path.c_str(), resolved) == NULL)
+		|| (stat(resolved, &st) != 0)) {
+
+		throw ViolatedPrecondition("STIL file does not exist");
+	}
+	string key=resolved;
+
+	{
+		lock_guard<mutex> lk(lock);
+		map<string, list< shared_ptr<const cached_file> >::iterator>::iterator
+			f=by_path.find(key);
+		if(f != by_path.end()) {
+			shared_ptr<const cached_file> file=*(f->second);
+			if((file->mtime == st.st_mtime)
+				&& (file->size == (uint64_t)st.st_size)) {
+
+				// Move it to the front of the list
+				files.splice(files.begin(), files, f->second);
+				hits++;
+				return file;
+			}
+			// The file has changed; it is executed again
+			used_bytes=used_bytes-file->bytes;
+			files.erase(f->second);
+			by_path.erase(f);
+		}
+		misses++;
+	}
+
+	shared_ptr<const cached_file> file=load(key, st.st_mtime, st.st_size);
+
+	lock_guard<mutex> lk(lock);
+	map<string, list< shared_ptr<const cached_file> >::iterator>::iterator
+		f=by_path.find(key);
+	if(f != by_path.end()) {
+		// Another request has cached it in the meantime
+		return *(f->second);
+	}
+	files.push_front(file);
+	by_path[key]=files.begin();
+	used_bytes=used_bytes+file->bytes;
+	enforce_budget();
+	return file;
+}
+
+
+/**
+ * Function to compile a file, and execute its pattern, keeping the values
+ * of each signal, the shape of each cycle, and the checkpoints of the
+ * offsets
+ * @param path is the canonical name of the STIL file
+ * @param mtime is its modification time
+ * @param size is its size in bytes
+ * @return the executed file
+ */
+shared_ptr<const stil_cache::cached_file> stil_cache::load(string path,
+	time_t mtime, uint64_t size) {
+
+	shared_ptr<cached_file> file=make_shared<cached_file>();
+	file->path=path;
+	file->mtime=mtime;
+	file->size=size;
+	file->num_cycles=0;
+
+	compiled_stil stil(path);
+	stil.compile(false);
+	file_analyzer run(stil, "");
+	cached_file *f=file.get();
+	// Shape of each distinct cycle, and the number of values of this one
+	map<vector<uint32_t>, uint32_t> shape_ids;
+	vector<uint32_t> counts;
+	run.set_cycle_sink([f, &shape_ids, &counts](long long c,
+		vector<string> &v) {
+
+		if(f->values.size() < v.size()) {
+			f->values.resize(v.size());
+		}
+		counts.resize(v.size());
+		for(size_t i=0; i<v.size(); i++) {
+			if((c%CHECKPOINT_STRIDE) == 0) {
+				f->checkpoints.push_back(f->values[i].size());
+			}
+			counts[i]=v[i].size();
+			f->values[i].append(v[i]);
+		}
+		map<vector<uint32_t>, uint32_t>::iterator s=shape_ids.find(counts);
+		if(s == shape_ids.end()) {
+			uint32_t id=shape_ids.size();
+			s=shape_ids.insert(make_pair(counts, id)).first;
+			f->shapes.insert(f->shapes.end(), counts.begin(), counts.end());
+		}
+		f->cycle_shapes.push_back(s->second);
+		f->num_cycles=c+1;
+	});
+	run.parse_input();
+	run.get_selected_signals(file->names, file->inputs);
+	run.get_wfts(file->wft_names, file->wft_periods);
+	file->values.resize(file->names.size());
+	// Checkpoint of the end of the last cycle, if it starts a block
+	if((file->num_cycles%CHECKPOINT_STRIDE) == 0) {
+		for(size_t i=0; i<file->names.size(); i++) {
+			file->checkpoints.push_back(file->values[i].size());
+		}
+	}
+
+	file->shapes.shrink_to_fit();
+	file->cycle_shapes.shrink_to_fit();
+	file->checkpoints.shrink_to_fit();
+	file->bytes=sizeof(cached_file)+file->shapes.capacity()*sizeof(uint32_t)
+		+file->cycle_shapes.capacity()*sizeof(uint32_t)
+		+file->checkpoints.capacity()*sizeof(uint64_t);
+	for(size_t i=0; i<file->names.size(); i++) {
+		file->values[i].shrink_to_fit();
+		file->bytes=file->bytes+file->values[i].capacity()
+			+file->names[i].capacity();
+	}
+	return file;
+}
+
+
+// Function to evict the least recently used files, but the most recent
+void stil_cache::enforce_budget() {
+	while((used_bytes > budget_bytes) && (files.size() > 1)) {
+		shared_ptr<const cached_file> file=files.back();
+		used_bytes=used_bytes-file->bytes;
+		by_path.erase(file->path);
+		files.pop_back();
+		evictions++;
+	}
+}
+
+
+/**
+ * Function to evict a file from the cache
+ * @param path is the name of the STIL file
+ * @return true if it was cached; else, return false
+ */
+bool stil_cache::evict(string path) {
+	char resolved[PATH_MAX];
+	if(realpath(path.c_str(), resolved) == NULL) {
+		return false;
+	}
+	lock_guard<mutex> lk(lock);
+	map<string, list< shared_ptr<const cached_file> >::iterator>::iterator
+		f=by_path.find(resolved);
+	if(f == by_path.end()) {
+		return false;
+	}
+	used_bytes=used_bytes-(*(f->second))->bytes;
+	files.erase(f->second);
+	by_path.erase(f);
+	evictions++;
+	return true;
+}
+
+
+// Function to describe the state of the cache, on a line
+string stil_cache::get_stats() {
+	lock_guard<mutex> lk(lock);
+	return "files " + to_string(files.size()) + " bytes "
+		+ to_string(used_bytes) + " budget " + to_string(budget_bytes)
+		+ " hits " + to_string(hits) + " misses " + to_string(misses)
+		+ " evictions " + to_string(evictions);
+}
@@ -0,0 +1,121 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Cache of executed STIL files, with a least-recently-used eviction policy
+ * A STIL file is compiled and its pattern executed once, when it is first
+ * asked for; the names of its signals, its WaveformTables, the values of
+ * each signal, and the number of values of each signal in each cycle are
+ * then kept in memory, so that any range of cycles is answered without
+ * executing the pattern again. The numbers of values of a cycle are kept
+ * as its shape, which is shared by every cycle with the same numbers, and
+ * the offset of the values of each signal is kept at the start of every
+ * CHECKPOINT_STRIDE cycles; the offset of any other cycle is recomputed
+ * from the shapes of the cycles before it in its block. Whilst the memory of the files exceeds the budget, the
+ * least recently used file is evicted. A file that changes on disk is
+ * executed again.
+ */
+
+// Import Header files from the C++ STL
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <time.h>
+
+
+#ifndef __STIL_CACHE_H
+#define __STIL_CACHE_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class stil_cache {
+	public:
+		// Initialize constants...
+		// Number of cycles between two checkpoints of the offsets
+		static const int CHECKPOINT_STRIDE = 64;
+
+		// Executed STIL file; it is read-only once it is cached
+		struct cached_file {
+			string path;
+			// Modification time and size of the file when it was executed
+			time_t mtime;
+			uint64_t size;
+			// Names of the signals (inputs, then outputs) and their values
+			vector<string> names;
+			vector<bool> inputs;
+			vector<string> values;
+			// Names and periods (in picoseconds) of the WaveformTables
+			vector<string> wft_names;
+			vector<int64_t> wft_periods;
+			long long num_cycles;
+			/**
+			 * Shapes of the cycles: the number of values of the signal "i"
+			 * in the shape "s" is shapes[s*(number of signals)+i], and the
+			 * shape of the cycle "c" is cycle_shapes[c]
+			 */
+			vector<uint32_t> shapes;
+			vector<uint32_t> cycle_shapes;
+			/**
+			 * Offset of the values of the signal "i" at the start of the
+			 * cycle b*CHECKPOINT_STRIDE, at checkpoints[b*(number of
+			 * signals)+i], up to the end of the last cycle
+			 */
+			vector<uint64_t> checkpoints;
+			// Bytes of memory that the file takes
+			uint64_t bytes;
+
+			// Values of the signal "i" from the cycle first to last-1
+			string get_values(size_t i, long long first, long long last) const;
+			// Offset of the values of the signal "i" at the start of a cycle
+			uint64_t get_offset(size_t i, long long cycle) const;
+			// Number of values of the signal "i" in a cycle
+			uint32_t get_count(size_t i, long long cycle) const;
+			// Index of the signal with this name; -1 if there is none
+			int find_signal(string name) const;
+		};
+
+		// Standard Constructor; budget is the memory of the files, in bytes
+		stil_cache(uint64_t budget);
+
+		// Define headers for functions...
+		/**
+		 * Get the executed file, from the cache, or by executing it; it
+		 * remains valid whilst it is held, even if it is evicted
+		 */
+		shared_ptr<const cached_file> get(string path);
+		// Evict a file; return false if it is not cached
+		bool evict(string path);
+		// Statistics of the cache, as a line of text
+		string get_stats();
+
+
+	private:
+		// Declaration of instance variables...
+		uint64_t budget_bytes;
+		uint64_t used_bytes;
+		// Files, from the most to the least recently used, and by path
+		list< shared_ptr<const cached_file> > files;
+		map<string, list< shared_ptr<const cached_file> >::iterator> by_path;
+		// Number of requests that were answered from the cache, or not
+		uint64_t hits;
+		uint64_t misses;
+		uint64_t evictions;
+		mutex lock;
+
+		// Compile and execute a file
+		shared_ptr<const cached_file> load(string path, time_t mtime,
+			uint64_t size);
+		// Evict the least recently used files, until the budget is met
+		void enforce_budget();
+		// Copy constructor and assignment are not supported
+		stil_cache(const stil_cache &);
+		stil_cache &operator=(const stil_cache &);
+};
+#endif
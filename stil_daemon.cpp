@@ -0,0 +1,336 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Resident query daemon on a Unix domain socket; see stil_daemon.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #Only local processes can connect; the socket is a file, whose
+ *	permissions are those of the daemon
+ * #The trace that file_analyzer prints on the standard output is of no use
+ *	to the daemon; it is suppressed whilst the daemon runs
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <iostream>
+#include <sstream>
+#include <exception>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "stil_daemon.h"
+#include "thread_pool.h"
+#include "ViolatedAssertion.h"
+#include "ViolatedPostcondition.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+/**
+ * Function to fill the address of a Unix domain socket
+ * @param path is the name of the socket
+ * @param addr is assigned the address
+ * @return false if the name is too long
+ */
+static bool socket_address(string path, struct sockaddr_un &addr) {
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family=AF_UNIX;
+	if(path.size() >= sizeof(addr.sun_path)) {
+		return false;
+	}
+	strcpy(addr.sun_path, path.c_str());
+	return true;
+}
+
+
+/**
+ * Function to write all bytes of a string to a socket
+ * @return false if the connection is closed
+ */
+static bool send_all(int fd, const string &s) {
+	size_t sent=0;
+	while(sent < s.size()) {
+		ssize_t w=send(fd, s.data()+sent, s.size()-sent, MSG_NOSIGNAL);
+		if(w < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		sent=sent+w;
+	}
+	return true;
+}
+
+// =======================================================================
+
+// Standard constructor
+stil_daemon::stil_daemon(string socket_path, uint64_t budget)
+	: cache(budget), stopping(false) {
+
+	socket_name=socket_path;
+	listen_fd=-1;
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to listen on the socket, and answer the requests of each
+ * connection, until SHUTDOWN is requested
+ * @param num_threads is the number of connections that are answered at the
+ *	same time
+ * @throws ViolatedPrecondition exception if the socket cannot be created
+ * @return nothing
+ */
+void stil_daemon::run(int num_threads) {
+	struct sockaddr_un addr;
+	if(!socket_address(socket_name, addr)) {
+		throw ViolatedPrecondition("Name of the socket is too long");
+	}
+	listen_fd=socket(AF_UNIX, SOCK_STREAM, 0);
+	// A socket that is left from a previous daemon is replaced
+	unlink(socket_name.c_str());
+	if((listen_fd < 0)
+		|| (bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+		|| (listen(listen_fd, SOMAXCONN) != 0)) {
+
+		cerr << "Socket " << socket_name << ": " << strerror(errno) << endl;
+		throw ViolatedPrecondition("Socket cannot be created");
+	}
+	cout << "Listening on " << socket_name << endl;
+
+	// Suppress the trace of the files on the standard output
+	cout.flush();
+	ios::iostate state=cout.rdstate();
+	cout.setstate(ios::failbit);
+	{
+		thread_pool pool(num_threads);
+		while(!stopping.load()) {
+			int fd=accept(listen_fd, NULL, NULL);
+			if(fd < 0) {
+				if((errno == EINTR) || (errno == ECONNABORTED)) {
+					continue;
+				}
+				// The socket is shut down by SHUTDOWN
+				break;
+			}
+			pool.submit([this, fd] {
+				serve(fd);
+			});
+		}
+		pool.wait();
+	}
+	cout.clear(state);
+
+	close(listen_fd);
+	unlink(socket_name.c_str());
+	cout << "Stopped listening on " << socket_name << endl;
+}
+
+
+/**
+ * Function to answer the requests of a connection, one on each line, until
+ * the connection is closed, or SHUTDOWN is requested
+ * A request that is longer than MAX_REQUEST bytes is answered by an error,
+ * and its connection is closed, so that a client that never sends a newline
+ * cannot grow the pending bytes without bound
+ * @param fd is the connection
+ * @return nothing
+ */
+void stil_daemon::serve(int fd) {
+	string pending;
+	char buf[4096];
+	bool open=true;
+	while(open && (!stopping.load())) {
+		// Wake up every so often, to close idle connections on SHUTDOWN
+		struct pollfd p;
+		p.fd=fd;
+		p.events=POLLIN;
+		if(poll(&p, 1, POLL_MS) == 0) {
+			continue;
+		}
+		ssize_t r=recv(fd, buf, sizeof(buf), 0);
+		if(r < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			break;
+		}
+		if(r == 0) {
+			break;
+		}
+		pending.append(buf, r);
+		size_t eol;
+		while(open && ((eol=pending.find('\n')) != string::npos)
+			&& (eol <= MAX_REQUEST)) {
+
+			string request=pending.substr(0, eol);
+			pending.erase(0, eol+1);
+			open=send_all(fd, answer(request));
+		}
+		if(open && (pending.size() > MAX_REQUEST)) {
+			send_all(fd, "ERROR Request too long\n");
+			open=false;
+		}
+	}
+	close(fd);
+}
+
+
+/**
+ * Function to answer a request
+ * @param request is the request, without its newline
+ * @return the response; a line that starts with "OK" or "ERROR", followed
+ *	by the lines of its data
+ */
+string stil_daemon::answer(string request) {
+	// Trim the carriage return of clients that send one
+	if((!request.empty()) && (request[request.size()-1] == '\r')) {
+		request.erase(request.size()-1);
+	}
+	istringstream words(request);
+	string command;
+	words >> command;
+
+	try {
+		if(command == "STATS") {
+			return "OK " + cache.get_stats() + "\n";
+		}
+		if(command == "SHUTDOWN") {
+			stopping.store(true);
+			// Wake the listening thread up
+			shutdown(listen_fd, SHUT_RDWR);
+			return "OK\n";
+		}
+
+		if((command != "LOAD") && (command != "CYCLES")
+			&& (command != "SIGNALS") && (command != "WFTS")
+			&& (command != "VALUES") && (command != "EVICT")) {
+
+			return "ERROR Unknown request: " + command + "\n";
+		}
+
+		string signal;
+		long long first=0;
+		long long last=0;
+		if(command == "VALUES") {
+			words >> signal >> first >> last;
+			if(words.fail()) {
+				return "ERROR VALUES [signal] [first] [last] [file]\n";
+			}
+		}
+		// The name of the file is the rest of the line
+		string path;
+		getline(words >> ws, path);
+		if(path.empty()) {
+			return "ERROR Missing name of the STIL file\n";
+		}
+
+		if(command == "EVICT") {
+			return cache.evict(path) ? "OK\n" : "ERROR Not cached\n";
+		}
+
+		shared_ptr<const stil_cache::cached_file> f=cache.get(path);
+		string out;
+		if(command == "LOAD") {
+			out="OK " + to_string(f->num_cycles) + " "
+				+ to_string(f->names.size()) + "\n";
+		}else if(command == "CYCLES") {
+			out="OK " + to_string(f->num_cycles) + "\n";
+		}else if(command == "SIGNALS") {
+			out="OK " + to_string(f->names.size()) + "\n";
+			for(size_t i=0; i<f->names.size(); i++) {
+				out.append(f->names[i]);
+				out.append(f->inputs[i] ? "\tin\n" : "\tout\n");
+			}
+		}else if(command == "WFTS") {
+			out="OK " + to_string(f->wft_names.size()) + "\n";
+			for(size_t i=0; i<f->wft_names.size(); i++) {
+				out.append(f->wft_names[i]);
+				out.append("\t");
+				out.append(to_string(f->wft_periods[i]));
+				out.append("\n");
+			}
+		}else{
+			int i=f->find_signal(signal);
+			if(i < 0) {
+				return "ERROR Unknown signal: " + signal + "\n";
+			}
+			if(first < 0) {
+				first=0;
+			}
+			if(last > f->num_cycles) {
+				last=f->num_cycles;
+			}
+			long long n=(last > first) ? (last-first) : 0;
+			out="OK " + to_string(n) + "\n";
+			// The values of the cycles follow each other
+			uint64_t offset=(n > 0) ? f->get_offset(i, first) : 0;
+			for(long long c=first; c<last; c++) {
+				uint32_t count=f->get_count(i, c);
+				out.append(to_string(c));
+				out.push_back('\t');
+				out.append(f->values[i], offset, count);
+				out.push_back('\n');
+				offset=offset+count;
+			}
+		}
+		return out;
+	}catch(ViolatedAssertion &e) {
+		return "ERROR " + e.get_message() + "\n";
+	}catch(ViolatedPrecondition &e) {
+		return "ERROR " + e.get_message() + "\n";
+	}catch(ViolatedPostcondition &e) {
+		return "ERROR " + e.get_message() + "\n";
+	}catch(exception &e) {
+		return "ERROR " + string(e.what()) + "\n";
+	}
+}
+
+
+/**
+ * Function to send requests to the daemon, and print its responses
+ * The connection is closed for writing after the requests, and every
+ * response is read until the daemon closes it
+ * @param socket_path is the name of the socket of the daemon
+ * @param requests is the requests, one on each line
+ * @param out is the stream that the responses are printed to
+ * @return false if the daemon cannot be reached
+ */
+bool stil_daemon::query(string socket_path, string requests, ostream &out) {
+	struct sockaddr_un addr;
+	int fd=socket(AF_UNIX, SOCK_STREAM, 0);
+	if((fd < 0) || (!socket_address(socket_path, addr))
+		|| (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)) {
+
+		if(fd >= 0) {
+			close(fd);
+		}
+		return false;
+	}
+	if((requests.empty()) || (requests[requests.size()-1] != '\n')) {
+		requests.push_back('\n');
+	}
+	send_all(fd, requests);
+	shutdown(fd, SHUT_WR);
+
+	char buf[65536];
+	ssize_t r;
+	while(((r=recv(fd, buf, sizeof(buf), 0)) > 0)
+		|| ((r < 0) && (errno == EINTR))) {
+
+		if(r > 0) {
+			out.write(buf, r);
+		}
+	}
+	close(fd);
+	return true;
+}
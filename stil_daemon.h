@@ -0,0 +1,83 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Resident daemon that answers queries on STIL files over a local Unix
+ * domain socket, from a cache of executed files (see stil_cache.h)
+ * Each request is a line of text, and each response starts with a line
+ * that is either "OK ..." or "ERROR [message]"; the name of the STIL file
+ * is the rest of the line, so that it may hold spaces:
+ *	LOAD [file]			OK [cycles] [signals]
+ *	CYCLES [file]		OK [cycles]
+ *	SIGNALS [file]		OK [n], then "[name]\t[in|out]" on n lines
+ *	WFTS [file]			OK [n], then "[name]\t[period in ps]" on n lines
+ *	VALUES [signal] [first] [last] [file]
+ *						OK [n], then "[cycle]\t[values]" for each of the
+ *						n cycles from first to last-1
+ *	EVICT [file]		OK
+ *	STATS				OK [statistics of the cache]
+ *	SHUTDOWN			OK; the daemon stops
+ * A connection may send any number of requests.
+ */
+
+// Import Header files from the C++ STL
+#include <string>
+#include <atomic>
+#include <stdint.h>
+
+#include "stil_cache.h"
+
+
+#ifndef __STIL_DAEMON_H
+#define __STIL_DAEMON_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class stil_daemon {
+	public:
+		// Initialize constants...
+		// Milliseconds between the checks of SHUTDOWN by an idle connection
+		static const int POLL_MS = 200;
+		// Default memory of the cached files, in MB
+		static const int DEFAULT_BUDGET_MB = 1024;
+		// Maximum length of a request; a longer one closes the connection
+		static const size_t MAX_REQUEST = 65536;
+
+		// Standard Constructor; budget is the memory of the cache, in bytes
+		stil_daemon(string socket_path, uint64_t budget);
+
+		// Define headers for functions...
+		/**
+		 * Listen on the socket, and answer the requests of each connection
+		 * on a thread of a pool of num_threads threads, until SHUTDOWN
+		 */
+		void run(int num_threads);
+		// Answer a request; the response ends with a newline
+		string answer(string request);
+		/**
+		 * Send the requests to the daemon on the socket, one on each line,
+		 * and print the responses; used by clients
+		 * @return false if the daemon cannot be reached
+		 */
+		static bool query(string socket_path, string requests, ostream &out);
+
+
+	private:
+		// Declaration of instance variables...
+		string socket_name;
+		stil_cache cache;
+		// Listening socket
+		int listen_fd;
+		// Has SHUTDOWN been requested?
+		atomic<bool> stopping;
+
+		// Answer the requests of a connection, until it is closed
+		void serve(int fd);
+		// Copy constructor and assignment are not supported
+		stil_daemon(const stil_daemon &);
+		stil_daemon &operator=(const stil_daemon &);
+};
+#endif
@@ -0,0 +1,403 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Sidecar index of the tabular output file; see table_index.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #The index is only valid for the table file that it was written with;
+ *	the size of the table file is kept in the index, and checked
+ * #The values of a row are contiguous, and are followed by a newline
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "table_index.h"
+#include "output_buffer.h"
+#include "ViolatedAssertion.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// =======================================================================
+
+// Default constructor
+table_index::table_index() {
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, TABLE_INDEX_MAGIC, sizeof(header.magic));
+	header.version=TABLE_INDEX_VERSION;
+	header.index_stride=1;
+	base=NULL;
+	size=0;
+}
+
+// Destructor
+table_index::~table_index() {
+	close();
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to add a row of the table to the index
+ * @param name is the name of the signal of the row
+ * @param row_offset is the offset of the row in the table file
+ * @param value_offset is the offset of the first value of the row
+ * @param num_values is the number of values in the row
+ * @return nothing
+ */
+void table_index::add_row(string name, uint64_t row_offset,
+	uint64_t value_offset, uint64_t num_values) {
+
+	table_index_row r;
+	memset(&r, 0, sizeof(r));
+	r.row_offset=row_offset;
+	r.value_offset=value_offset;
+	r.num_values=num_values;
+	r.name_offset=strings.size();
+	r.name_length=name.size();
+	strings.append(name);
+	rows.push_back(r);
+}
+
+
+/**
+ * Function to set the chunks of the rows
+ * @param num_cycles is the number of cycles in the pattern
+ * @param stride is the number of cycles in each chunk
+ * @param offsets holds the index of the first value of each chunk in each
+ *	row, checkpoint-major
+ * @throws ViolatedPrecondition exception if the offsets do not hold a
+ *	whole number of chunks
+ * @return nothing
+ */
+void table_index::set_chunks(uint64_t num_cycles, uint32_t stride,
+	const vector<uint64_t> &offsets) {
+
+	if(rows.empty() || ((offsets.size()%rows.size()) != 0)) {
+		throw ViolatedPrecondition("Chunks do not match the rows of the table");
+	}
+	header.num_cycles=num_cycles;
+	header.index_stride=stride;
+	header.num_chunks=offsets.size()/rows.size();
+	chunks=offsets;
+}
+
+
+/**
+ * Function to write the index
+ * @param filename is the name of the index
+ * @param table_size is the size of the table file
+ * @throws ViolatedPrecondition exception if the index cannot be created
+ * @return nothing
+ */
+void table_index::write(string filename, uint64_t table_size) {
+	output_buffer out(64*1024);
+	if(!out.open(filename)) {
+		cerr << "Index file, with the filename " << filename
+			<< ", cannot be created!" << endl;
+		throw ViolatedPrecondition("Invalid file name");
+	}
+
+	header.num_rows=rows.size();
+	header.table_size=table_size;
+	header.row_table_offset=sizeof(table_index_header);
+	header.chunk_table_offset=header.row_table_offset
+		+ rows.size()*sizeof(table_index_row);
+	header.string_table_offset=header.chunk_table_offset
+		+ chunks.size()*sizeof(uint64_t);
+
+	out.write((const char *)&header, sizeof(header));
+	if(!rows.empty()) {
+		out.write((const char *)&rows[0], rows.size()*sizeof(table_index_row));
+	}
+	if(!chunks.empty()) {
+		out.write((const char *)&chunks[0], chunks.size()*sizeof(uint64_t));
+	}
+	out.write(strings);
+	out.close();
+}
+
+
+/**
+ * Function to map an index into memory, and to check its header
+ * The row table, the chunk table and the names of the rows must lie within
+ * the index, so that a truncated or corrupt index is rejected here rather
+ * than read out of bounds
+ * @param filename is the name of the index
+ * @throws ViolatedPrecondition exception if the index cannot be opened, or
+ *	is not a valid index of a table
+ * @return nothing
+ */
+void table_index::open(string filename) {
+	close();
+
+	int fd=::open(filename.c_str(), O_RDONLY);
+	if(fd < 0) {
+		cerr << "Index file, with the filename " << filename
+			<< ", does not exist!" << endl;
+		throw ViolatedPrecondition("Invalid file name");
+	}
+	struct stat st;
+	if((fstat(fd, &st) != 0)
+		|| (st.st_size < (off_t)sizeof(table_index_header))) {
+
+		::close(fd);
+		throw ViolatedPrecondition("Index file is truncated");
+	}
+
+	size=st.st_size;
+	void *p=mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if(p == MAP_FAILED) {
+		size=0;
+		throw ViolatedPrecondition("Index file cannot be mapped");
+	}
+	base=(const char *)p;
+
+	// Check the header...
+	mapped_header=(const table_index_header *)base;
+	if((memcmp(mapped_header->magic, TABLE_INDEX_MAGIC,
+			sizeof(mapped_header->magic)) != 0)
+		|| (mapped_header->version != TABLE_INDEX_VERSION)) {
+
+		close();
+		throw ViolatedPrecondition("File is not an index of a table");
+	}
+	if(mapped_header->index_stride == 0) {
+		close();
+		throw ViolatedPrecondition("Index file has a stride of 0");
+	}
+
+	// ... locate the sections...
+	check_array(mapped_header->row_table_offset, mapped_header->num_rows,
+		sizeof(table_index_row));
+	if(mapped_header->num_rows > 0) {
+		check_array(mapped_header->chunk_table_offset, mapped_header->num_chunks,
+			(uint64_t)mapped_header->num_rows*sizeof(uint64_t));
+	}
+	check_section(mapped_header->string_table_offset, 0);
+	row_table=(const table_index_row *)(base+mapped_header->row_table_offset);
+	chunk_table=(const uint64_t *)(base+mapped_header->chunk_table_offset);
+	string_table=base+mapped_header->string_table_offset;
+
+	// ... and the names of the rows
+	for(uint32_t i=0; i<mapped_header->num_rows; i++) {
+		check_section(mapped_header->string_table_offset
+			+ row_table[i].name_offset, row_table[i].name_length);
+	}
+}
+
+
+/**
+ * Function to check that a section lies within the index
+ * @throws ViolatedPrecondition exception if the section is out of bounds
+ */
+void table_index::check_section(uint64_t offset, uint64_t length) {
+	if((offset > size) || (length > (size-offset))) {
+		close();
+		throw ViolatedPrecondition("Index file is truncated");
+	}
+}
+
+
+/**
+ * Function to check that a table of "count" entries of "width" bytes lies
+ * within the index, without overflowing its length
+ * @throws ViolatedPrecondition exception if the table is out of bounds
+ */
+void table_index::check_array(uint64_t offset, uint64_t count,
+	uint64_t width) {
+
+	if(count > (size/width)) {
+		close();
+		throw ViolatedPrecondition("Index file is truncated");
+	}
+	check_section(offset, count*width);
+}
+
+
+// Function to unmap the index
+void table_index::close() {
+	if(base != NULL) {
+		munmap((void *)base, size);
+	}
+	base=NULL;
+	size=0;
+}
+
+
+// Row entry of the mapped index, with bounds checking
+const table_index_row &table_index::get_row(uint32_t row) {
+	if((base == NULL) || (row >= mapped_header->num_rows)) {
+		throw ViolatedPrecondition("Row is out of range");
+	}
+	return row_table[row];
+}
+
+
+// Information in the header...
+uint32_t table_index::get_num_rows() {
+	return mapped_header->num_rows;
+}
+
+uint64_t table_index::get_num_cycles() {
+	return mapped_header->num_cycles;
+}
+
+uint32_t table_index::get_index_stride() {
+	return mapped_header->index_stride;
+}
+
+
+/**
+ * Function to search for a row by the name of its signal
+ * @param name is the name of the signal
+ * @return the index of the row; -1 if it is not found
+ * O(n) computational time complexity
+ */
+int table_index::find_row(string name) {
+	for(uint32_t i=0; i<mapped_header->num_rows; i++) {
+		if((row_table[i].name_length == name.size())
+			&& (memcmp(string_table+row_table[i].name_offset, name.data(),
+				name.size()) == 0)) {
+
+			return i;
+		}
+	}
+	return -1;
+}
+
+
+// Information about a row...
+string table_index::get_name(uint32_t row) {
+	const table_index_row &r=get_row(row);
+	return string(string_table+r.name_offset, r.name_length);
+}
+
+uint64_t table_index::get_num_values(uint32_t row) {
+	return get_row(row).num_values;
+}
+
+
+/**
+ * Function to locate a value of a row in the table file
+ * @param row is the index of the row
+ * @param i is the index of the value
+ * @return the offset of the value in the table file
+ * O(1) computational time complexity
+ */
+uint64_t table_index::get_value_offset(uint32_t row, uint64_t i) {
+	const table_index_row &r=get_row(row);
+	if(i > r.num_values) {
+		throw ViolatedPrecondition("Value is out of range");
+	}
+	return r.value_offset+i;
+}
+
+
+/**
+ * Function to get the first cycle of the chunk that holds a cycle
+ * @param cycle is the cycle
+ * @return the cycle, rounded down to the start of its chunk
+ * O(1) computational time complexity
+ */
+uint64_t table_index::get_chunk_cycle(uint64_t cycle) {
+	return (cycle/mapped_header->index_stride)*mapped_header->index_stride;
+}
+
+
+/**
+ * Function to locate the chunk that holds a cycle in a row
+ * @param row is the index of the row
+ * @param cycle is the cycle; it is rounded down to the start of its chunk,
+ *	unless it is the end of the last cycle
+ * @throws ViolatedAssertion exception if the index has no chunks
+ * @throws ViolatedPrecondition exception if the cycle is past the end of
+ *	the last cycle
+ * @return the index of the first value of that chunk in the row; the
+ *	number of values of the row for the end of the last cycle
+ * O(1) computational time complexity
+ */
+uint64_t table_index::get_chunk_value(uint32_t row, uint64_t cycle) {
+	const table_index_row &r=get_row(row);
+	if(mapped_header->num_chunks == 0) {
+		throw ViolatedAssertion("Index has no chunks of cycles");
+	}
+	if(cycle > mapped_header->num_cycles) {
+		throw ViolatedPrecondition("Cycle is out of range");
+	}
+
+	uint64_t chunk=cycle/mapped_header->index_stride;
+	if((cycle == mapped_header->num_cycles)
+		&& ((chunk >= mapped_header->num_chunks)
+		|| ((cycle%mapped_header->index_stride) != 0))) {
+
+		return r.num_values;
+	}
+	return chunk_table[chunk*mapped_header->num_rows + row];
+}
+
+
+/**
+ * Function to read consecutive values of a row from the table file
+ * @param table_fd is the file descriptor of the table file
+ * @param row is the index of the row
+ * @param first is the index of the first value
+ * @param count is the number of values; it is clipped to the last value
+ * @throws ViolatedAssertion exception if the table file does not match
+ *	the index, or cannot be read
+ * @return the values
+ * O(n) computational time complexity, for n values
+ */
+string table_index::read_values(int table_fd, uint32_t row, uint64_t first,
+	uint64_t count) {
+
+	const table_index_row &r=get_row(row);
+	struct stat st;
+	if((fstat(table_fd, &st) != 0)
+		|| ((uint64_t)st.st_size != mapped_header->table_size)) {
+
+		throw ViolatedAssertion("Table file does not match its index");
+	}
+	if(first >= r.num_values) {
+		return "";
+	}
+	if(count > (r.num_values-first)) {
+		count=r.num_values-first;
+	}
+
+	string values(count, ' ');
+	uint64_t done=0;
+	while(done < count) {
+		ssize_t n=pread(table_fd, &values[done], count-done,
+			r.value_offset+first+done);
+		if(n < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			throw ViolatedAssertion("Table file cannot be read");
+		}
+		if(n == 0) {
+			throw ViolatedAssertion("Table file is truncated");
+		}
+		done=done+n;
+	}
+	return values;
+}
+
+
+// Name of the index of a table file
+string table_index::index_filename(string table_filename) {
+	return table_filename+".idx";
+}
@@ -0,0 +1,149 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Sidecar index of the tabular output file, which is written next to it
+ * with the suffix ".idx"
+ * Each value in a row of the table is a single character, so that the
+ * value of a signal at any quantum of time is found in O(1), from the
+ * offset of the first value of its row.
+ *
+ * The index is made of the following sections; each section starts at an
+ * offset that is a multiple of 8 bytes:
+ * #Index header (table_index_header)
+ * #Row table: a table_index_row for each row of the table, in the order of
+ *	the rows; inputs before outputs
+ * #Chunk table: the chunks of each row hold index_stride cycles (V vectors)
+ *	each; for every chunk, the index of the first value of the chunk in
+ *	each row, checkpoint-major like the cycle index of pattern_format.h
+ * #String table: names of the signals
+ *
+ * All integers are little-endian.
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+
+
+#ifndef __TABLE_INDEX_H
+#define __TABLE_INDEX_H
+using namespace std;
+
+// =======================================================================
+
+// Magic number at the start of the index, followed by the version
+#define TABLE_INDEX_MAGIC "STILIDX1"
+#define TABLE_INDEX_VERSION 1
+
+
+// Header of the index
+struct table_index_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t num_rows;
+	// Size of the table file that is indexed
+	uint64_t table_size;
+	// Number of cycles (V vectors) in each chunk
+	uint32_t index_stride;
+	uint32_t reserved;
+	// Number of cycles in the pattern
+	uint64_t num_cycles;
+	// Number of chunks in each row
+	uint64_t num_chunks;
+	// Offsets of the sections from the start of the index
+	uint64_t row_table_offset;
+	uint64_t chunk_table_offset;
+	uint64_t string_table_offset;
+};
+
+
+// Entry of a row in the row table
+struct table_index_row {
+	// Offset of the row, and of its first value, in the table file
+	uint64_t row_offset;
+	uint64_t value_offset;
+	// Number of values in the row
+	uint64_t num_values;
+	// Name of the signal in the string table
+	uint32_t name_offset;
+	uint32_t name_length;
+};
+
+
+// Class definition...
+class table_index {
+	public:
+		// Default constructor
+		table_index();
+		// Destructor; unmaps the index
+		~table_index();
+
+		// Define headers for functions...
+		// Functions to build the index while the table is written
+		void add_row(string name, uint64_t row_offset, uint64_t value_offset,
+			uint64_t num_values);
+		void set_chunks(uint64_t num_cycles, uint32_t stride,
+			const vector<uint64_t> &offsets);
+		// Write the index of the table file with the given size
+		void write(string filename, uint64_t table_size);
+
+		// Functions to look values up in an index that has been written
+		void open(string filename);
+		void close();
+		uint32_t get_num_rows();
+		uint64_t get_num_cycles();
+		uint32_t get_index_stride();
+		// Index of the row of the signal with the given name; -1 if none
+		int find_row(string name);
+		string get_name(uint32_t row);
+		uint64_t get_num_values(uint32_t row);
+		// Offset of the value "i" of a row in the table file
+		uint64_t get_value_offset(uint32_t row, uint64_t i);
+		// First cycle of the chunk that holds "cycle"
+		uint64_t get_chunk_cycle(uint64_t cycle);
+		/**
+		 * Index of the first value of the chunk that holds "cycle" in a row;
+		 * it is the first value of the cycle, if the cycle starts a chunk,
+		 * and the number of values of the row at the end of the last cycle
+		 * @throws ViolatedPrecondition if the cycle is past the last cycle
+		 */
+		uint64_t get_chunk_value(uint32_t row, uint64_t cycle);
+		// Read "count" values of a row from "first", from the table file
+		string read_values(int table_fd, uint32_t row, uint64_t first,
+			uint64_t count);
+
+		// Name of the index of a table file
+		static string index_filename(string table_filename);
+
+
+	private:
+		// Declaration of instance variables...
+		// Index that is being built
+		table_index_header header;
+		vector<table_index_row> rows;
+		vector<uint64_t> chunks;
+		string strings;
+		// Start and size of the mapped index
+		const char *base;
+		size_t size;
+		// Sections of the mapped index
+		const table_index_header *mapped_header;
+		const table_index_row *row_table;
+		const uint64_t *chunk_table;
+		const char *string_table;
+
+		// Row entry of the mapped index, with bounds checking
+		const table_index_row &get_row(uint32_t row);
+		// Check that a section or a table lies within the mapped index
+		void check_section(uint64_t offset, uint64_t length);
+		void check_array(uint64_t offset, uint64_t count, uint64_t width);
+		// Copy constructor and assignment are not supported
+		table_index(const table_index &);
+		table_index &operator=(const table_index &);
+};
+#endif
@@ -0,0 +1,206 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Pool of worker threads with work stealing; see thread_pool.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #A job must not wait for other jobs of the same pool
+ * #The pool must outlive the jobs that are submitted to it
+ */
+
+// Import Header files from the C++ STL and the directory
+#include "thread_pool.h"
+#include "trace_events.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// Index of the worker that runs on this thread; -1 outside of any pool
+static thread_local int worker_id=-1;
+// Pool of the worker that runs on this thread
+static thread_local thread_pool *worker_pool=NULL;
+
+// =======================================================================
+
+// Standard constructor
+thread_pool::thread_pool(int num_threads) {
+	if(num_threads < 1) {
+		throw ViolatedPrecondition("Thread pool needs at least one thread");
+	}
+	num_queued=0;
+	num_pending=0;
+	next_queue=0;
+	stopping=false;
+
+	for(int i=0; i<num_threads; i++) {
+		queues.push_back(new job_queue());
+	}
+	for(int i=0; i<num_threads; i++) {
+		workers.push_back(thread(&thread_pool::run, this, i));
+	}
+}
+
+// Destructor
+thread_pool::~thread_pool() {
+	{
+		unique_lock<mutex> l(state_lock);
+		all_done.wait(l, [this] { return num_pending == 0; });
+		stopping=true;
+	}
+	work_available.notify_all();
+	for(size_t i=0; i<workers.size(); i++) {
+		workers[i].join();
+	}
+	for(size_t i=0; i<queues.size(); i++) {
+		delete queues[i];
+	}
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to submit a job to the pool
+ * @param job is the job
+ * @return nothing
+ */
+void thread_pool::submit(function<void()> job) {
+	// Queue of the current worker, or the next queue in round-robin order
+	int q;
+	if((worker_pool == this) && (worker_id >= 0)) {
+		q=worker_id;
+	}else{
+		lock_guard<mutex> l(state_lock);
+		q=next_queue%queues.size();
+		next_queue++;
+	}
+
+	{
+		lock_guard<mutex> l(queues[q]->lock);
+		queues[q]->jobs.push_back(job);
+	}
+	{
+		lock_guard<mutex> l(state_lock);
+		num_queued++;
+		num_pending++;
+	}
+	work_available.notify_one();
+}
+
+
+/**
+ * Function to take a job: the most recent job of the own queue, or else
+ * the oldest job of another queue
+ * @param id is the index of the worker
+ * @param job is assigned the job
+ * @return true if a job is taken; else, return false
+ */
+bool thread_pool::take_job(int id, function<void()> &job) {
+	{
+		lock_guard<mutex> l(queues[id]->lock);
+		if(!queues[id]->jobs.empty()) {
+			job=queues[id]->jobs.back();
+			queues[id]->jobs.pop_back();
+			return true;
+		}
+	}
+
+	// Steal from the other workers, starting from the next worker
+	for(size_t i=1; i<queues.size(); i++) {
+		job_queue *victim=queues[(id+i)%queues.size()];
+		lock_guard<mutex> l(victim->lock);
+		if(!victim->jobs.empty()) {
+			job=victim->jobs.front();
+			victim->jobs.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/**
+ * Function that runs the jobs on a worker thread, until the pool is stopped
+ * @param id is the index of the worker
+ * @return nothing
+ */
+void thread_pool::run(int id) {
+	worker_id=id;
+	worker_pool=this;
+	trace_events::set_thread_name("worker", id);
+
+	while(true) {
+		{
+			unique_lock<mutex> l(state_lock);
+			work_available.wait(l, [this] { return stopping || (num_queued > 0); });
+			if(num_queued == 0) {
+				// The pool is stopped, and no job is left
+				return;
+			}
+			// Claim a queued job, which is taken below
+			num_queued--;
+		}
+
+		function<void()> job;
+		while(!take_job(id, job)) {
+			/**
+			 * There are at least as many queued jobs as claims, but the
+			 * queues are not scanned atomically; look again
+			 */
+			this_thread::yield();
+		}
+
+		try {
+			trace_events::scope event("task");
+			job();
+		}catch(...) {
+			lock_guard<mutex> l(state_lock);
+			if(!failure) {
+				failure=current_exception();
+			}
+		}
+
+		{
+			lock_guard<mutex> l(state_lock);
+			num_pending--;
+			if(num_pending == 0) {
+				all_done.notify_all();
+			}
+		}
+	}
+}
+
+
+/**
+ * Function to wait until all submitted jobs have been run
+ * @throws the first exception that was thrown by a job, if any
+ * @return nothing
+ */
+void thread_pool::wait() {
+	exception_ptr e;
+	{
+		unique_lock<mutex> l(state_lock);
+		all_done.wait(l, [this] { return num_pending == 0; });
+		e=failure;
+		failure=exception_ptr();
+	}
+	if(e) {
+		rethrow_exception(e);
+	}
+}
+
+
+// Number of worker threads
+int thread_pool::get_num_threads() {
+	return workers.size();
+}
+
+
+// Number of threads that the hardware runs concurrently
+int thread_pool::hardware_threads() {
+	unsigned int n=thread::hardware_concurrency();
+	return (n > 0) ? n : 1;
+}
@@ -0,0 +1,87 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Pool of worker threads with work stealing
+ * Each worker has its own queue of jobs; a worker takes the most recent
+ * job from its own queue, and steals the oldest job from the queues of the
+ * other workers when its own queue is empty.
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+
+#ifndef __THREAD_POOL_H
+#define __THREAD_POOL_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class thread_pool {
+	public:
+		// Standard Constructor; starts the worker threads
+		thread_pool(int num_threads);
+		// Destructor; waits for the jobs, and stops the worker threads
+		~thread_pool();
+
+		// Define headers for functions...
+		/**
+		 * Submit a job; a job that is submitted by a worker is queued on
+		 * the queue of that worker
+		 */
+		void submit(function<void()> job);
+		/**
+		 * Wait until all submitted jobs have been run
+		 * @throws the first exception that was thrown by a job
+		 */
+		void wait();
+		// Number of worker threads
+		int get_num_threads();
+
+		// Number of threads that the hardware runs concurrently; at least 1
+		static int hardware_threads();
+
+
+	private:
+		// Queue of jobs of a worker
+		struct job_queue {
+			mutex lock;
+			deque< function<void()> > jobs;
+		};
+
+		// Declaration of instance variables...
+		vector<thread> workers;
+		vector<job_queue *> queues;
+		// Lock and conditions for idle workers, and for wait()
+		mutex state_lock;
+		condition_variable work_available;
+		condition_variable all_done;
+		// Number of jobs that are queued, and that are not yet completed
+		long num_queued;
+		long num_pending;
+		// Queue of the next job that is submitted from outside the pool
+		unsigned int next_queue;
+		// Are the workers being stopped?
+		bool stopping;
+		// First exception that was thrown by a job
+		exception_ptr failure;
+
+		// Main loop of a worker
+		void run(int id);
+		// Take a job, from the queue of the worker "id" or from another
+		bool take_job(int id, function<void()> &job);
+		// Copy constructor and assignment are not supported
+		thread_pool(const thread_pool &);
+		thread_pool &operator=(const thread_pool &);
+};
+#endif
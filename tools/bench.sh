@@ -0,0 +1,83 @@
+#!/bin/sh
+# This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+# test pattern format that contains input test patterns for execution on
+# automatic test equipment
+
+# Benchmark of the parser on synthetic STIL files (see tools/stilgen.cpp)
+# Each dimension of the generator is swept on its own, from a base file;
+# for each point, the size of the file, the cycles, the wall time, the
+# throughput (MB/s and cycles/s), the time of each cycle and the peak
+# resident set size are printed, so that the curve of each dimension shows
+# how the parser scales with it.
+# i.e., tools/bench.sh [parser] [stilgen] [options of the parser]
+# BENCH_SCALE multiplies the sizes of the sweeps (1 by default), and
+# BENCH_DIR is the directory of the generated files.
+
+PARSER=${1:-./parse.out}
+STILGEN=${2:-./tools/stilgen}
+if [ $# -ge 2 ]; then
+	shift 2
+else
+	set --
+fi
+PARSER_OPTIONS="$*"
+SCALE=${BENCH_SCALE:-1}
+DIR=${BENCH_DIR:-/tmp/stil_bench}
+mkdir -p "$DIR" || exit 1
+
+# Value of a field of the JSON statistics of a run
+field() {
+	sed -n "s/.*\"$1\":\([0-9]*\).*/\1/p" "$DIR/stats.json"
+}
+
+# Run the parser on a generated file, and print a row of the sweep
+# i.e., point [dimension] [value] [options of stilgen]
+point() {
+	name=$1
+	value=$2
+	shift 2
+	"$STILGEN" "$@" > "$DIR/bench.stil" || exit 1
+	if ! "$PARSER" "$DIR/bench.stil" "$DIR/bench.txt" --stats=json $PARSER_OPTIONS \
+		> /dev/null 2> "$DIR/stats.json"; then
+		echo "$name $value: the parser failed" >&2
+		exit 1
+	fi
+	bytes=$(wc -c < "$DIR/bench.stil")
+	awk -v n="$name" -v v="$value" -v b="$bytes" -v c="$(field cycles)" \
+		-v w="$(field wall_ns)" -v r="$(field peak_rss_kb)" 'BEGIN {
+		s=w/1e9; if(s <= 0) s=1e-9;
+		printf "%-13s %8s %9.2f %9d %9.3f %8.2f %11.0f %9.0f %8.1f\n",
+			n, v, b/1048576, c, s, b/1048576/s, c/s, (c > 0) ? w/c : 0,
+			r/1024
+	}'
+}
+
+# Sweep a dimension over values, the other dimensions being those of base
+# i.e., sweep [dimension] [options] [values] [base options of stilgen]
+# The options are comma separated; each is set to the value
+sweep() {
+	name=$1
+	options=$2
+	values=$3
+	shift 3
+	for v in $values; do
+		point "$name" "$v" "$@" $(echo "$options" | \
+			sed "s/\([^,]*\)/--\1=$v/g; s/,/ /g")
+	done
+	echo
+}
+
+printf "%-13s %8s %9s %9s %9s %8s %11s %9s %8s\n" "dimension" "value" \
+	"MB" "cycles" "wall s" "MB/s" "cycles/s" "ns/cycle" "RSS MB"
+sweep vectors vectors "$((100*SCALE)) $((1000*SCALE)) $((10000*SCALE))" \
+	--calls=10
+sweep calls calls "$((10*SCALE)) $((100*SCALE)) $((1000*SCALE))" \
+	--vectors=10
+sweep chain-length chain-length "$((100*SCALE)) $((1000*SCALE)) $((10000*SCALE))" \
+	--calls=10
+sweep chains chains "2 8 32" --calls=10 --chain-length=$((1000*SCALE))
+sweep pins inputs,outputs "4 16 64" --calls=10 --vectors=$((1000*SCALE))
+sweep wfts wfts "0 4 16" --calls=16 --vectors=$((500*SCALE))
+sweep groups groups "0 16 256" --calls=10 --vectors=$((1000*SCALE))
+sweep line line "0 200 2000" --calls=10 --vectors=$((2000*SCALE))
+rm -f "$DIR/bench.stil" "$DIR/bench.txt" "$DIR/stats.json"
@@ -0,0 +1,101 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Driver of the lazy generator of the cycles, stil_cycles()
+ * The STIL file is compiled, and its cycles are pulled from the generator
+ * and printed as the rows of --stream: a header with the names of the
+ * selected signals, then the index of each cycle and the values of each
+ * signal in that cycle. --limit stops after as many cycles, which destroys
+ * the generator before the end of the pattern. tools/regress.sh compares
+ * its rows with those of --stream, with the same options.
+ * i.e., cycles [STIL file] [--select=LIST] [--cycles=A:B] [--limit=N]
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <iostream>
+#include <string>
+#include <stdlib.h>
+
+#include "cycle_generator.h"
+#include "ViolatedAssertion.h"
+#include "ViolatedPrecondition.h"
+#include "ViolatedPostcondition.h"
+
+using namespace std;
+
+// Function to print the usage of the driver
+static int usage() {
+	cerr << "i.e., cycles [STIL file] [--select=LIST] [--cycles=A:B]";
+	cerr << " [--limit=N]" << endl;
+	return 1;
+}
+
+// =======================================================================
+
+int main(int argc, char *argv[]) {
+	if(argc < 2) {
+		return usage();
+	}
+	string spec;
+	long long first=0;
+	long long last=-1;
+	long long limit=-1;
+	for(int i=2; i<argc; i++) {
+		string option=argv[i];
+		if(option.compare(0, 9, "--select=") == 0) {
+			spec=option.substr(9);
+		}else if(option.compare(0, 9, "--cycles=") == 0) {
+			string value=option.substr(9);
+			size_t colon=value.find(':');
+			if(colon == string::npos) {
+				return usage();
+			}
+			first=atoll(value.substr(0, colon).c_str());
+			if((colon+1) < value.size()) {
+				last=atoll(value.substr(colon+1).c_str());
+			}
+		}else if(option.compare(0, 8, "--limit=") == 0) {
+			limit=atoll(option.substr(8).c_str());
+		}else{
+			return usage();
+		}
+	}
+
+	try {
+		compiled_stil stil(argv[1]);
+		stil.compile(false);
+		long long n=0;
+		bool header=false;
+		for(const cycle_view &v : stil_cycles(stil, spec, first, last)) {
+			if((limit >= 0) && (n >= limit)) {
+				break;
+			}
+			if(!header) {
+				cout << "cycle";
+				for(size_t i=0; i<v.get_num_signals(); i++) {
+					cout << "\t" << v.get_name(i);
+				}
+				cout << "\n";
+				header=true;
+			}
+			cout << v.get_cycle();
+			for(size_t i=0; i<v.get_num_signals(); i++) {
+				cout << "\t" << v.get_values(i);
+			}
+			cout << "\n";
+			n++;
+		}
+	}catch(ViolatedAssertion &e) {
+		cerr << e.get_message() << endl;
+		return 1;
+	}catch(ViolatedPrecondition &e) {
+		cerr << e.get_message() << endl;
+		return 1;
+	}catch(ViolatedPostcondition &e) {
+		cerr << e.get_message() << endl;
+		return 1;
+	}
+	return 0;
+}
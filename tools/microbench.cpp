@@ -0,0 +1,293 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Microbenchmarks of the string and expansion primitives of the parser,
+ * which run for each token or each value
+ * Each benchmark is run with an increasing number of iterations, until it
+ * takes at least the minimum time; its time for each iteration, and its
+ * throughput over the bytes of its input, are then printed, in the manner
+ * of Google Benchmark.
+ * i.e., microbench [--filter=SUBSTRING] [--min-time=MS]
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #Inputs that are quadratic in the primitives (a string with a whitespace
+ *	or an apostrophe every few characters) are kept to 64 KB, so that a
+ *	single iteration takes seconds, not hours; the other large inputs are
+ *	scan strings of 1 MB
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <functional>
+#include <time.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "file_analyzer.h"
+#include "signalZ.h"
+
+using namespace std;
+
+/**
+ * Benchmark: a function that runs its primitive a number of times, and the
+ * bytes of input of each iteration (0 if its throughput is meaningless)
+ */
+struct benchmark {
+	string name;
+	uint64_t bytes;
+	function<void(long long)> run;
+};
+
+
+// Sink of the results of the primitives, so that they are not optimized out
+static volatile uint64_t sink;
+
+// Function to keep the size of a result
+static void keep(size_t n) {
+	sink=sink+n;
+}
+
+
+// Function to read the monotonic clock, in nanoseconds
+static int64_t now_ns() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec*1000000000LL+ts.tv_nsec;
+}
+
+
+/**
+ * Function to make a string of n characters, that repeats a pattern
+ * @param pattern is the pattern
+ * @param n is the size of the string
+ * @return the string
+ */
+static string repeat(string pattern, size_t n) {
+	string s;
+	s.reserve(n);
+	while(s.size() < n) {
+		s.append(pattern, 0, min(pattern.size(), n-s.size()));
+	}
+	return s;
+}
+
+
+/**
+ * Function to make a signal with a waveform, a period and a quantum
+ * @param name is the name of the signal; masterClk and scanClk are clocks
+ * @param period_ns is its period, in nanoseconds
+ * @param clock is true for the waveform of a clock; else, of D/U
+ * @return the signal
+ */
+static signalZ *make_signal(string name, int period_ns, bool clock) {
+	signalZ *s=new signalZ(name);
+	s->set_quantum(file_analyzer::MEASURE_OF_TIME_PS);
+	s->set_sig_period((int64_t)period_ns*signalZ::PS_PER_UNIT_OF_TIME);
+	if(clock) {
+		s->add_wave_prop(signalZ::make_wave_prop(0, "D"));
+		s->add_wave_prop(signalZ::make_wave_prop(50000, "U"));
+		s->add_wave_prop(signalZ::make_wave_prop(80000, "D"));
+	}else{
+		s->add_wave_prop(signalZ::make_wave_prop(0, "D/U"));
+	}
+	return s;
+}
+
+
+/**
+ * Function to run a benchmark, with an increasing number of iterations,
+ * until it takes at least the minimum time, and print its row
+ * @param b is the benchmark
+ * @param min_ns is the minimum time, in nanoseconds
+ * @return nothing
+ */
+static void run_benchmark(const benchmark &b, int64_t min_ns) {
+	long long iterations=1;
+	int64_t elapsed=0;
+	while(true) {
+		int64_t start=now_ns();
+		b.run(iterations);
+		elapsed=now_ns()-start;
+		if((elapsed >= min_ns) || (iterations >= (1LL << 40))) {
+			break;
+		}
+		// Aim past the minimum time, without growing more than 10 times
+		long long next=(elapsed > 0)
+			? (long long)(iterations*1.4*min_ns/elapsed) : iterations*10;
+		iterations=max(iterations+1, min(next, iterations*10));
+	}
+
+	double per_iteration=(double)elapsed/iterations;
+	cout << left << setw(40) << b.name << right << setw(14) << fixed
+		<< setprecision(1) << per_iteration << " ns" << setw(12)
+		<< iterations;
+	if(b.bytes > 0) {
+		cout << setw(12) << setprecision(2)
+			<< (b.bytes*1e9/per_iteration/1048576) << " MB/s";
+	}
+	cout << endl;
+}
+
+// =======================================================================
+
+// Start of main function...
+int main(int argc, char *argv[]) {
+	string filter;
+	int64_t min_ns=200000000;
+	for(int i=1; i<argc; i++) {
+		string option=argv[i];
+		if(option.compare(0, 9, "--filter=") == 0) {
+			filter=option.substr(9);
+		}else if(option.compare(0, 11, "--min-time=") == 0) {
+			min_ns=atoll(option.substr(11).c_str())*1000000LL;
+		}else{
+			cerr << "i.e., microbench [--filter=SUBSTRING] [--min-time=MS]";
+			cerr << endl;
+			return 1;
+		}
+	}
+
+	// Inputs of the benchmarks
+	const size_t MB=1048576;
+	const size_t QUADRATIC_SIZE=65536;
+	file_analyzer fa;
+	string group="'scanIn1+scanIn2+piPin+masterClk;+scanClk'";
+	string assignment="scanIn1=0101010101;";
+	string scan=repeat("0110100110010110", MB);
+	string quoted_scan="'" + scan + "';";
+	string quoted_names=repeat("'piPin'+", QUADRATIC_SIZE);
+	string statement="   V  { piPin = 1; poPin = L; }";
+	string spaced=repeat(statement, QUADRATIC_SIZE);
+
+	vector<benchmark> benchmarks;
+	benchmarks.push_back({"delimit_string/group", group.size(),
+		[&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.delimit_string(group).size());
+			}
+		}});
+	benchmarks.push_back({"delimit_string/assignment", assignment.size(),
+		[&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.delimit_string(assignment).size());
+			}
+		}});
+	benchmarks.push_back({"delimit_string/scan_1MB", quoted_scan.size(),
+		[&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.delimit_string(quoted_scan).size());
+			}
+		}});
+	benchmarks.push_back({"delimit_string/apostrophes_64KB",
+		quoted_names.size(), [&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.delimit_string(quoted_names).size());
+			}
+		}});
+	benchmarks.push_back({"truncate_whitespace/statement", statement.size(),
+		[&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.truncate_whitespace(statement).size());
+			}
+		}});
+	benchmarks.push_back({"truncate_whitespace/scan_1MB", scan.size(),
+		[&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.truncate_whitespace(scan).size());
+			}
+		}});
+	benchmarks.push_back({"truncate_whitespace/spaced_64KB", spaced.size(),
+		[&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.truncate_whitespace(spaced).size());
+			}
+		}});
+	benchmarks.push_back({"int_to_str/7", 0, [&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.int_to_str(7).size());
+			}
+		}});
+	benchmarks.push_back({"int_to_str/2147483647", 0, [&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.int_to_str(2147483647).size());
+			}
+		}});
+	benchmarks.push_back({"time_to_string/100ns", 0, [&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.time_to_string(100, 1).size());
+			}
+		}});
+	benchmarks.push_back({"time_to_string/1ms", 0, [&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.time_to_string(1000000, 0).size());
+			}
+		}});
+	benchmarks.push_back({"chop_ns/50ns", 0, [&](long long n) {
+			for(long long i=0; i<n; i++) {
+				keep(fa.chop_ns("50ns").size());
+			}
+		}});
+
+	// Values are taken from the signals after each iteration, and dropped
+	signalZ *pin=make_signal("scanIn1", 20, false);
+	signalZ *clk=make_signal("masterClk", 100, true);
+	string row;
+	benchmarks.push_back({"sig_vector/value", 1, [&](long long n) {
+			for(long long i=0; i<n; i++) {
+				pin->sig_vector("1");
+				row.clear();
+				pin->take_values(row);
+			}
+			keep(row.size());
+		}});
+	benchmarks.push_back({"sig_vector/scan_1MB", scan.size(),
+		[&](long long n) {
+			for(long long i=0; i<n; i++) {
+				pin->sig_vector(scan);
+				row.clear();
+				pin->take_values(row);
+			}
+			keep(row.size());
+		}});
+	benchmarks.push_back({"clk_waveform/high", 0, [&](long long n) {
+			for(long long i=0; i<n; i++) {
+				clk->clk_waveform('1');
+				row.clear();
+				clk->take_values(row);
+			}
+			keep(row.size());
+		}});
+	benchmarks.push_back({"clk_waveform/low", 0, [&](long long n) {
+			for(long long i=0; i<n; i++) {
+				clk->clk_waveform('0');
+				row.clear();
+				clk->take_values(row);
+			}
+			keep(row.size());
+		}});
+	benchmarks.push_back({"sig_vector/clock_4KB", 4096, [&](long long n) {
+			string pulses=scan.substr(0, 4096);
+			for(long long i=0; i<n; i++) {
+				clk->sig_vector(pulses);
+				row.clear();
+				clk->take_values(row);
+			}
+			keep(row.size());
+		}});
+
+	cout << left << setw(40) << "Benchmark" << right << setw(17) << "Time"
+		<< setw(12) << "Iterations" << setw(17) << "Throughput" << endl;
+	for(size_t b=0; b<benchmarks.size(); b++) {
+		if(benchmarks[b].name.find(filter) != string::npos) {
+			run_benchmark(benchmarks[b], min_ns);
+		}
+	}
+	delete pin;
+	delete clk;
+	return 0;
+}
@@ -0,0 +1,293 @@
+#!/bin/sh
+# This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+# test pattern format that contains input test patterns for execution on
+# automatic test equipment
+
+# Regression of the parser on a corpus of STIL files
+# The corpus is "stil.1", files that are generated by tools/stilgen with
+# fixed seeds, and the files of REGRESS_CORPUS, if any. Each file is parsed
+# by each mode of the parser (REGRESS_MODES), and:
+# - the SHA-256 of its output file is checked against its golden, in
+#	tools/regress.golden ("case mode hash" on each line);
+# - its throughput (the best of REGRESS_RUNS runs) and its peak resident
+#	set size are appended to the history file, REGRESS_HISTORY;
+# - its throughput and peak resident set size are compared with the median
+#	of its last REGRESS_WINDOW passing runs in the history; it fails if it
+#	is more than REGRESS_THRESHOLD percent slower, or larger.
+# Runs that are shorter than REGRESS_MIN_MS milliseconds are too noisy to
+# be timed; only their output is checked. The exit status is 1 if any case
+# fails. The modes cover the engines of the table, the other formats of the
+# output file, --select, --cycles, and the sidecar index of --index, with
+# what --lookup and --lookup-cycle read back from it. The times of the VCD
+# file of each file are also checked against the cycles of --stream, by
+# tools/vcd_check.sh, and the cycles of the generator stil_cycles(), which
+# tools/cycles prints, against the rows of --stream. REGRESS_UPDATE=1 writes
+# the hashes of this run as the goldens, instead of checking them, after a
+# change of the output that is intended.
+# i.e., tools/regress.sh [parser] [stilgen] [cycles]
+
+PARSER=${1:-./parse.out}
+STILGEN=${2:-./tools/stilgen}
+CYCLES=${3:-./tools/cycles}
+GOLDEN=${REGRESS_GOLDEN:-tools/regress.golden}
+HISTORY=${REGRESS_HISTORY:-regress.history}
+THRESHOLD=${REGRESS_THRESHOLD:-15}
+RUNS=${REGRESS_RUNS:-3}
+WINDOW=${REGRESS_WINDOW:-5}
+MIN_MS=${REGRESS_MIN_MS:-20}
+MODES=${REGRESS_MODES:-"table stream pipeline threads binary vcd
+	vector select cycles index lookup"}
+UPDATE=${REGRESS_UPDATE:-0}
+CORPUS=${REGRESS_CORPUS:-}
+DIR=${REGRESS_DIR:-/tmp/stil_regress}
+mkdir -p "$DIR" || exit 1
+rm -f "$DIR/golden.new"
+touch "$HISTORY" || exit 1
+
+if command -v sha256sum > /dev/null 2>&1; then
+	SHA="sha256sum"
+else
+	SHA="shasum -a 256"
+fi
+REVISION=$(git rev-parse --short HEAD 2> /dev/null || echo unknown)
+NOW=$(date -u +%Y-%m-%dT%H:%M:%SZ)
+FAILED=0
+
+# Options of the parser for a mode
+options() {
+	case $1 in
+		table) echo "" ;;
+		stream) echo "--stream" ;;
+		pipeline) echo "--pipeline" ;;
+		threads) echo "--threads=2" ;;
+		binary) echo "--format=binary" ;;
+		vcd) echo "--format=vcd" ;;
+		vector) echo "--format=vector" ;;
+		select) echo "--select=scanIn1,scanOut2,poPin" ;;
+		cycles) echo "--cycles=2:" ;;
+		index|lookup) echo "--index" ;;
+		*) echo "Unknown mode: $1" >&2; exit 1 ;;
+	esac
+}
+
+# Value of a field of the JSON statistics of a run
+field() {
+	sed -n "s/.*\"$1\":\([0-9]*\).*/\1/p" "$DIR/stats.json"
+}
+
+# Look up the values of each signal of the indexed table, $DIR/out, after
+# its summary, $DIR/lookup.summary: all of them, the second half of them,
+# all of its cycles, and its middle cycle
+lookups() {
+	cat "$DIR/lookup.summary"
+	cycles=$(sed -n 's/^Cycles: //p' "$DIR/lookup.summary")
+	awk -F'\t' 'NF == 2 {print $1, $2}' "$DIR/lookup.summary" |
+	while read -r signal count; do
+		"$PARSER" --lookup "$DIR/out" "$signal" 0 "$count" || return 1
+		"$PARSER" --lookup "$DIR/out" "$signal" $((count/2)) \
+			$((count-count/2)) || return 1
+		"$PARSER" --lookup-cycle "$DIR/out" "$signal" 0 "$cycles" || return 1
+		"$PARSER" --lookup-cycle "$DIR/out" "$signal" $((cycles/2)) 1 \
+			|| return 1
+	done
+}
+
+
+# Output of a mode whose hash is checked: the output file, with its index
+# for index, and what is looked up in its index for lookup
+# i.e., result [mode]
+result() {
+	case $1 in
+		index) cat "$DIR/out" "$DIR/out.idx" ;;
+		lookup)
+			"$PARSER" --lookup "$DIR/out" > "$DIR/lookup.summary" || return 1
+			lookups ;;
+		*) cat "$DIR/out" ;;
+	esac
+}
+
+
+# Run a case in a mode, check its output and its history, and print its row
+# i.e., check [case] [STIL file] [mode]
+check() {
+	name=$1
+	file=$2
+	mode=$3
+	best=""
+	rss=""
+	run=0
+	while [ $run -lt "$RUNS" ]; do
+		if ! "$PARSER" "$file" "$DIR/out" --stats=json $(options "$mode") \
+			> /dev/null 2> "$DIR/stats.json"; then
+
+			printf "%-10s %-9s the parser failed\n" "$name" "$mode"
+			FAILED=1
+			return
+		fi
+		wall=$(field wall_ns)
+		if [ -z "$best" ] || [ "$wall" -lt "$best" ]; then
+			best=$wall
+			rss=$(field peak_rss_kb)
+		fi
+		run=$((run+1))
+	done
+	if ! result "$mode" > "$DIR/result"; then
+		printf "%-10s %-9s the lookups failed\n" "$name" "$mode"
+		FAILED=1
+		return
+	fi
+	hash=$($SHA < "$DIR/result" | cut -d' ' -f1)
+	bytes=$(wc -c < "$file")
+
+	status=ok
+	if [ "$UPDATE" = "1" ]; then
+		echo "$name $mode $hash" >> "$DIR/golden.new"
+	else
+		golden=$(awk -v c="$name" -v m="$mode" '$1 == c && $2 == m {print $3}' \
+			"$GOLDEN" 2> /dev/null)
+		if [ -z "$golden" ]; then
+			status=no-golden
+		elif [ "$golden" != "$hash" ]; then
+			status=output
+		fi
+	fi
+
+	# Compare with the median of the last passing runs of the history
+	awk -v c="$name" -v m="$mode" -v w="$WINDOW" -v b="$bytes" -v ns="$best" \
+		-v r="$rss" -v t="$THRESHOLD" -v min="$MIN_MS" -v s="$status" \
+		-v row="$DIR/row" '
+	function median(a, n,    i, j, x) {
+		for(i=2; i<=n; i++) {
+			x=a[i]
+			for(j=i-1; (j >= 1) && (a[j] > x); j--) a[j+1]=a[j]
+			a[j+1]=x
+		}
+		return (n % 2) ? a[(n+1)/2] : (a[n/2]+a[n/2+1])/2
+	}
+	$3 == c && $4 == m && $7 == "ok" && $5 > 0 {
+		n++
+		speed[n]=$5
+		mem[n]=$6
+	}
+	END {
+		mbps=(ns > 0) ? b/1048576/(ns/1e9) : 0
+		timed=(ns/1e6 >= min)
+		base=""
+		change=""
+		k=0
+		for(i=((n > w) ? n-w+1 : 1); i<=n; i++) {
+			k++
+			ws[k]=speed[i]
+			wm[k]=mem[i]
+		}
+		if(timed && (k > 0)) {
+			base=median(ws, k)
+			basemem=median(wm, k)
+			change=sprintf("%+.1f%%", 100*(mbps-base)/base)
+			if((s == "ok") && (mbps < base*(1-t/100))) s="slower"
+			if((s == "ok") && (r > basemem*(1+t/100))) s="memory"
+		}
+		printf "%-10s %-9s %9.3f %9s %9s %8s %9d %s\n", c, m, ns/1e6,
+			timed ? sprintf("%.2f", mbps) : "-",
+			(base == "") ? "-" : sprintf("%.2f", base), change, r, s
+		# MB/s (0 if the run is not timed), RSS and status, for the history
+		printf "%.3f %d %s\n", (timed ? mbps : 0), r, s > row
+	}' "$HISTORY"
+	status=$(awk '{print $3}' "$DIR/row")
+	echo "$NOW $REVISION $name $mode $(cat "$DIR/row")" >> "$HISTORY"
+	if [ "$status" != "ok" ]; then
+		FAILED=1
+	fi
+}
+
+# Check the times of the VCD file of a case against its cycles
+# i.e., check_vcd_times [case] [STIL file]
+check_vcd_times() {
+	if sh "$(dirname "$0")/vcd_check.sh" "$PARSER" "$2" > "$DIR/vcd_check" \
+		2>&1; then
+
+		printf "%-10s %-9s %s\n" "$1" "vcd-times" "ok"
+	else
+		printf "%-10s %-9s %s\n" "$1" "vcd-times" "$(tail -1 "$DIR/vcd_check")"
+		FAILED=1
+	fi
+}
+
+# Check the cycles of the generator of a case against the rows of --stream:
+# all of them, the first 3 only, and a slice of some of the signals
+# i.e., check_cycles [case] [STIL file]
+check_cycles() {
+	why=""
+	if ! "$PARSER" "$2" "$DIR/out" --stream > /dev/null \
+		|| ! "$CYCLES" "$2" > "$DIR/cycles"; then
+
+		why="the parser or tools/cycles failed"
+	elif ! tail -n +3 "$DIR/out" | cmp -s - "$DIR/cycles"; then
+		why="the cycles differ from --stream"
+	elif ! "$CYCLES" "$2" --limit=3 > "$DIR/cycles" \
+		|| ! tail -n +3 "$DIR/out" | head -4 | cmp -s - "$DIR/cycles"; then
+
+		why="the first 3 cycles differ from --stream"
+	else
+		slice="--select=scanIn1,scanOut2,poPin --cycles=1:5"
+		if ! "$PARSER" "$2" "$DIR/out" --stream $slice > /dev/null \
+			|| ! "$CYCLES" "$2" $slice > "$DIR/cycles" \
+			|| ! tail -n +3 "$DIR/out" | cmp -s - "$DIR/cycles"; then
+
+			why="the cycles differ from --stream $slice"
+		fi
+	fi
+	printf "%-10s %-9s %s\n" "$1" "generator" "${why:-ok}"
+	if [ -n "$why" ]; then
+		FAILED=1
+	fi
+}
+
+
+# Run a case in every mode
+# i.e., check_case [case] [STIL file]
+check_case() {
+	for mode in $MODES; do
+		check "$1" "$2" "$mode"
+	done
+	check_vcd_times "$1" "$2"
+	check_cycles "$1" "$2"
+}
+
+# Generate a case with tools/stilgen, and run it in every mode
+# i.e., generated [case] [options of stilgen]
+generated() {
+	name=$1
+	shift
+	"$STILGEN" "$@" > "$DIR/$name.stil" || exit 1
+	check_case "$name" "$DIR/$name.stil"
+}
+
+printf "%-10s %-9s %9s %9s %9s %8s %9s %s\n" "case" "mode" "wall ms" \
+	"MB/s" "base MB/s" "change" "RSS KB" "status"
+check_case stil.1 stil.1
+generated small --seed=1
+generated vectors --vectors=1000 --calls=10 --seed=2
+generated scan --chains=4 --chain-length=2000 --calls=20 --seed=3
+generated wide --inputs=32 --outputs=32 --vectors=100 --calls=5 --seed=4
+generated wfts --wfts=8 --calls=20 --vectors=200 --seed=5
+generated lines --groups=64 --line=200 --calls=10 --vectors=1000 --seed=6
+if [ -n "$CORPUS" ]; then
+	for f in "$CORPUS"/*; do
+		if [ -f "$f" ]; then
+			check_case "$(basename "$f")" "$f"
+		fi
+	done
+fi
+
+if [ "$UPDATE" = "1" ]; then
+	mv "$DIR/golden.new" "$GOLDEN"
+	echo "The goldens are written to $GOLDEN"
+fi
+rm -f "$DIR"/*.stil "$DIR/out" "$DIR/out.idx" "$DIR/stats.json" "$DIR/row" \
+	"$DIR/vcd_check" "$DIR/result" "$DIR/lookup.summary" "$DIR/cycles"
+if [ "$FAILED" != "0" ]; then
+	echo "Regression: FAILED (threshold $THRESHOLD%)"
+	exit 1
+fi
+echo "Regression: passed (threshold $THRESHOLD%)"
@@ -0,0 +1,392 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Generator of synthetic STIL files, for benchmarks
+ * The files follow the layout of "stil.1", which the parser expects, with
+ * tunable dimensions:
+ *	--inputs=N			primary input pins (piPin, piPin2, ...)
+ *	--outputs=N			primary output pins (poPin, poPin2, ...)
+ *	--chains=N			scan chains (scanIn1/scanOut1, ...)
+ *	--chain-length=N	bits that are shifted through each chain
+ *	--groups=N			extra SignalGroups, that the parser skips
+ *	--wfts=N			extra WaveformTables, each applied by a Macro before
+ *						the vectors of a Call
+ *	--calls=N			pairs of SCANLOAD and SCANUNLOAD Calls of scanProc
+ *	--vectors=N			V statements between the Calls of each pair
+ *	--line=N			maximum length of a line of V statements; 0 for a
+ *						V on each line
+ *	--seed=N			seed of the values
+ * i.e., stilgen [options] > [STIL filename]
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #The names of the signals, groups, WaveformTables and blocks are those
+ *	that the parser looks for; the extra names contain none of its keywords
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include <stdint.h>
+
+using namespace std;
+
+/**
+ * Dimensions of the generated file; see the options above
+ */
+struct stil_dimensions {
+	int inputs;
+	int outputs;
+	int chains;
+	int chain_length;
+	int groups;
+	int wfts;
+	long long calls;
+	long long vectors;
+	int line;
+	uint64_t seed;
+};
+
+
+// State of the generator of pseudo-random values (xorshift64)
+static uint64_t state=88172645463325252ULL;
+
+// Function to get the next pseudo-random bit
+static int next_bit() {
+	state^=state << 13;
+	state^=state >> 7;
+	state^=state << 17;
+	return (int)((state >> 32) & 1);
+}
+
+
+/**
+ * Function to obtain the value of an option of the form --name=value
+ * @param option is the option given to the program
+ * @param name is the name of the option, including its "=" sign
+ * @param value is assigned the value of the option, if it is found
+ * @return true if the option has this name; else, return false
+ */
+static bool option_value(string option, string name, long long &value) {
+	if(option.compare(0, name.size(), name) != 0) {
+		return false;
+	}
+	value=atoll(option.substr(name.size()).c_str());
+	return true;
+}
+
+
+// Function to name the i-th pin, from 0, with a prefix
+static string pin_name(string prefix, int i) {
+	ostringstream s;
+	s << prefix;
+	if(i > 0) {
+		s << (i+1);
+	}
+	return s.str();
+}
+
+
+// Function to name the i-th scan chain, from 0, with a prefix
+static string chain_name(string prefix, int i) {
+	ostringstream s;
+	s << prefix << (i+1);
+	return s.str();
+}
+
+
+/**
+ * Function to write the value of a C statement for the input group: the
+ * scan inputs and the primary inputs are 0, and one of the clocks is P
+ * @param master_pulse is true if masterClk pulses; else, scanClk pulses
+ * @return the value
+ */
+static string input_condition(const stil_dimensions &d, bool master_pulse) {
+	string s(d.chains+d.inputs, '0');
+	s=s + (master_pulse ? "P0" : "0P");
+	return s;
+}
+
+
+/**
+ * Function to write the header, signals, groups and Timing blocks
+ * @param d is the dimensions of the file
+ * @param out is the stream to be written
+ * @return nothing
+ */
+static void write_definitions(const stil_dimensions &d, ostream &out) {
+	out << "STIL 1.0;" << endl;
+	out << "Header {" << endl;
+	out << "   Title Synthetic STIL Input File\";" << endl;
+	out << "   Date \"Sat March 24 2007\";" << endl;
+	out << "}" << endl << endl;
+
+	out << "Signals {" << endl;
+	for(int i=0; i<d.chains; i++) {
+		out << "   " << chain_name("scanIn", i) << "    In   { ScanIn; }" << endl;
+	}
+	for(int i=0; i<d.chains; i++) {
+		out << "   " << chain_name("scanOut", i) << "   Out  { ScanOut; }" << endl;
+	}
+	out << "   masterClk  In;" << endl;
+	out << "   scanClk    In;" << endl;
+	for(int i=0; i<d.inputs; i++) {
+		out << "   " << pin_name("piPin", i) << "      In;" << endl;
+	}
+	for(int i=0; i<d.outputs; i++) {
+		out << "   " << pin_name("poPin", i) << "      Out;" << endl;
+	}
+	out << "}" << endl << endl;
+
+	// The input group holds the scan inputs, the inputs, then the clocks
+	out << "SignalGroups {" << endl;
+	out << "   piPins = '";
+	for(int i=0; i<d.chains; i++) {
+		out << chain_name("scanIn", i) << "+";
+	}
+	for(int i=0; i<d.inputs; i++) {
+		out << pin_name("piPin", i) << "+";
+	}
+	out << "masterClk+scanClk';" << endl;
+	out << "   poPins = '";
+	for(int i=0; i<d.chains; i++) {
+		out << chain_name("scanOut", i) << "+";
+	}
+	for(int i=0; i<d.outputs; i++) {
+		out << pin_name("poPin", i) << ((i+1 < d.outputs) ? "+" : "");
+	}
+	out << "';" << endl;
+	for(int g=0; g<d.groups; g++) {
+		out << "   bus" << g << " = '" << pin_name("piPin", g % d.inputs)
+			<< "+" << pin_name("poPin", g % d.outputs) << "';" << endl;
+	}
+	out << "   allPins = 'piPins+poPins';" << endl;
+	out << "}" << endl << endl;
+
+	out << "Timing {" << endl;
+	for(int k=-1; k<d.wfts; k++) {
+		if(k < 0) {
+			out << "   WaveformTable baseWFT {" << endl;
+			out << "      Period '100ns';" << endl;
+		}else{
+			out << "   WaveformTable wft" << k << " {" << endl;
+			out << "      Period '" << (100+20*(k+1)) << "ns';" << endl;
+		}
+		out << "      Waveforms {" << endl;
+		out << "         piPins 	{ 01 { '0ns', D/U; } }" << endl;
+		out << "         masterClk 	{ P  { '0ns' D; '50ns' U; '80ns' D; } }" << endl;
+		out << "	 poPins		{ X  { '0ns' X; } }" << endl;
+		out << "	 poPins		{ LH { '0ns' X; '40ns' H/L; } }" << endl;
+		out << "      }" << endl;
+		out << "    }" << endl;
+	}
+	out << "   WaveformTable scanWFT {" << endl;
+	out << "      Period '50ns';" << endl;
+	out << "      Waveforms {" << endl;
+	out << "         piPins         { 01   { '0ns', D/U; } }" << endl;
+	out << "         scanClk      	{ P    { '0ns' D; '20ns' U; '30ns' D; } }" << endl;
+	out << "         poPins         { XLH  { '0ns' X; '25ns' X/H/L; } }" << endl;
+	out << "      }" << endl;
+	out << "    }" << endl;
+	out << "}" << endl << endl;
+}
+
+
+/**
+ * Function to write the Procedures and Macrodefs blocks
+ * @param d is the dimensions of the file
+ * @param out is the stream to be written
+ * @return nothing
+ */
+static void write_procedures(const stil_dimensions &d, ostream &out) {
+	string outputs(d.chains+d.outputs, 'X');
+	out << "Procedures {" << endl;
+	out << "   scanProc {" << endl;
+	out << "      W scanWFT;" << endl;
+	out << "      C { piPins=" << input_condition(d, false) << "; poPins="
+		<< outputs << "; }" << endl;
+	out << "      V { piPins=1; }" << endl;
+	out << "      Shift {" << endl;
+	out << "	V {";
+	for(int i=0; i<d.chains; i++) {
+		out << " " << chain_name("scanIn", i) << "=#;";
+	}
+	for(int i=0; i<d.chains; i++) {
+		out << " " << chain_name("scanOut", i) << "=#;";
+	}
+	out << " }" << endl;
+	out << "      }" << endl;
+	out << "   }" << endl;
+	out << "}" << endl << endl;
+
+	out << "Macrodefs {" << endl;
+	for(int k=-1; k<d.wfts; k++) {
+		if(k < 0) {
+			out << "   sampleSetup {" << endl;
+			out << "     W baseWFT;" << endl;
+		}else{
+			out << "   setup" << k << " {" << endl;
+			out << "     W wft" << k << ";" << endl;
+		}
+		out << "     C { piPins=" << input_condition(d, true) << "; poPins="
+			<< outputs << "; }" << endl;
+		out << "     V { piPin = 1; }" << endl;
+		out << "   }" << endl;
+	}
+	out << "}" << endl << endl;
+}
+
+
+/**
+ * Function to write a V statement with pseudo-random values of the
+ * primary inputs and outputs
+ * @param d is the dimensions of the file
+ * @return the statement
+ */
+static string vector_statement(const stil_dimensions &d) {
+	string s="V  {";
+	for(int i=0; i<d.inputs; i++) {
+		s=s + " " + pin_name("piPin", i) + " = " + (next_bit() ? "1" : "0")
+			+ ";";
+	}
+	for(int i=0; i<d.outputs; i++) {
+		s=s + " " + pin_name("poPin", i) + " = " + (next_bit() ? "H" : "L")
+			+ ";";
+	}
+	return s + " }";
+}
+
+
+/**
+ * Function to write a Call of scanProc, with a pattern for each chain
+ * @param d is the dimensions of the file
+ * @param load is true for a SCANLOAD; else, for a SCANUNLOAD
+ * @param out is the stream to be written
+ * @return nothing
+ */
+static void write_call(const stil_dimensions &d, bool load, ostream &out) {
+	out << (load ? "   SCANLOAD:" : "   SCANUNLOAD:") << endl;
+	out << "   Call scanProc {" << endl;
+	for(int i=0; i<d.chains; i++) {
+		out << "      " << chain_name(load ? "scanIn" : "scanOut", i) << "=";
+		string bits(d.chain_length, '0');
+		for(int b=0; b<d.chain_length; b++) {
+			if(load) {
+				bits[b]=next_bit() ? '1' : '0';
+			}else{
+				bits[b]=next_bit() ? 'H' : 'L';
+			}
+		}
+		out << bits << ";" << endl;
+	}
+	out << "   }" << endl;
+}
+
+
+/**
+ * Function to write the Pattern block
+ * @param d is the dimensions of the file
+ * @param out is the stream to be written
+ * @return nothing
+ */
+static void write_pattern(const stil_dimensions &d, ostream &out) {
+	out << "Pattern samplePattern {" << endl;
+	out << "   Macro sampleSetup;" << endl << endl;
+	for(long long c=0; c<d.calls; c++) {
+		write_call(d, true, out);
+		// Each extra WaveformTable is applied, in turn, to the vectors
+		if(d.wfts > 0) {
+			out << "   Macro setup" << (c % d.wfts) << ";" << endl;
+		}
+		string line;
+		for(long long v=0; v<d.vectors; v++) {
+			string s=vector_statement(d);
+			if((!line.empty()) && ((d.line <= 0)
+				|| (line.size()+1+s.size() > (size_t)d.line))) {
+
+				out << line << endl;
+				line.clear();
+			}
+			line=line + (line.empty() ? "   " : " ") + s;
+		}
+		if(!line.empty()) {
+			out << line << endl;
+		}
+		out << endl;
+		write_call(d, false, out);
+	}
+	out << "} " << endl;
+}
+
+// =======================================================================
+
+// Start of main function...
+int main(int argc, char *argv[]) {
+	stil_dimensions d;
+	d.inputs=1;
+	d.outputs=1;
+	d.chains=2;
+	d.chain_length=10;
+	d.groups=0;
+	d.wfts=0;
+	d.calls=1;
+	d.vectors=2;
+	d.line=0;
+	d.seed=1;
+
+	for(int i=1; i<argc; i++) {
+		string option=argv[i];
+		long long value;
+		if(option_value(option, "--inputs=", value)) {
+			d.inputs=value;
+		}else if(option_value(option, "--outputs=", value)) {
+			d.outputs=value;
+		}else if(option_value(option, "--chains=", value)) {
+			d.chains=value;
+		}else if(option_value(option, "--chain-length=", value)) {
+			d.chain_length=value;
+		}else if(option_value(option, "--groups=", value)) {
+			d.groups=value;
+		}else if(option_value(option, "--wfts=", value)) {
+			d.wfts=value;
+		}else if(option_value(option, "--calls=", value)) {
+			d.calls=value;
+		}else if(option_value(option, "--vectors=", value)) {
+			d.vectors=value;
+		}else if(option_value(option, "--line=", value)) {
+			d.line=value;
+		}else if(option_value(option, "--seed=", value)) {
+			d.seed=value;
+		}else{
+			cerr << "Unknown option: " << option << endl;
+			cerr << "i.e., stilgen [--inputs=N] [--outputs=N] [--chains=N]";
+			cerr << " [--chain-length=N] [--groups=N] [--wfts=N] [--calls=N]";
+			cerr << " [--vectors=N] [--line=N] [--seed=N] > [STIL filename]";
+			cerr << endl;
+			return 1;
+		}
+	}
+	// The Macros and Calls of the parser need a pin and a chain of each kind
+	if((d.inputs < 1) || (d.outputs < 1) || (d.chains < 1)
+		|| (d.chain_length < 1) || (d.calls < 1) || (d.groups < 0)
+		|| (d.wfts < 0) || (d.vectors < 0)) {
+
+		cerr << "Inputs, outputs, chains, their length and calls must be";
+		cerr << " positive" << endl;
+		return 1;
+	}
+	state=state ^ (d.seed*0x9E3779B97F4A7C15ULL);
+	if(state == 0) {
+		state=1;
+	}
+
+	ios::sync_with_stdio(false);
+	write_definitions(d, cout);
+	write_procedures(d, cout);
+	write_pattern(d, cout);
+	return 0;
+}
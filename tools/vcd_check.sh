@@ -0,0 +1,111 @@
+#!/bin/sh
+# This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+# test pattern format that contains input test patterns for execution on
+# automatic test equipment
+
+# Check of the times of a VCD file against the cycles of --stream
+# The STIL file is parsed with --stream, and with --format=vcd, with the
+# same options. The changes in the values of each signal are derived from
+# the rows of the cycles: each row lasts as many quanta of time as its cell
+# with the most values, and each value takes a quantum from the start of its
+# row. They must be the changes of the VCD file, at the same times, in
+# quanta of the VCD file. The exit status is 1 if they differ.
+# i.e., tools/vcd_check.sh [parser] [STIL file] [options of the parser]
+
+PARSER=${1:-./parse.out}
+FILE=${2:-stil.1}
+shift 2 2> /dev/null
+DIR=${VCD_CHECK_DIR:-/tmp/stil_vcd_check}
+mkdir -p "$DIR" || exit 1
+
+if ! "$PARSER" "$FILE" "$DIR/cycles.txt" --stream "$@" > /dev/null \
+	|| ! "$PARSER" "$FILE" "$DIR/out.vcd" --format=vcd "$@" > /dev/null; then
+
+	echo "VCD check of $FILE: the parser failed"
+	exit 1
+fi
+
+# Changes of the rows of the cycles, as "name time value", in quanta of time
+awk -F'\t' '
+function logic(c) {
+	if((c == "0") || (c == "L")) return "0"
+	if((c == "1") || (c == "H")) return "1"
+	if((c == "Z") || (c == "T")) return "z"
+	return "x"
+}
+$1 == "cycle" {
+	for(i=2; i<=NF; i++) {
+		name[i]=$i
+		last[i]="x"
+	}
+	n=NF
+	rows=1
+	next
+}
+rows {
+	width=0
+	for(i=2; i<=n; i++) {
+		if(length($i) > width) width=length($i)
+	}
+	for(i=2; i<=n; i++) {
+		for(k=1; k<=length($i); k++) {
+			v=logic(substr($i, k, 1))
+			if(v != last[i]) {
+				print name[i], start+k-1, v
+				last[i]=v
+			}
+		}
+	}
+	start += width
+}' "$DIR/cycles.txt" | sort -k1,1 -k2,2n > "$DIR/cycles.changes"
+
+# Changes of the VCD file, as "name time value", in picoseconds
+awk '
+$1 == "$var" {
+	name[$4]=$5
+	last[$4]="x"
+	next
+}
+/^#/ {
+	now=substr($0, 2)
+	next
+}
+/^[01xz]/ {
+	id=substr($0, 2)
+	v=substr($0, 1, 1)
+	if(v != last[id]) {
+		print name[id], now, v
+		last[id]=v
+	}
+}' "$DIR/out.vcd" | sort -k1,1 -k2,2n > "$DIR/vcd.changes"
+
+# The times must be in the same ratio: the quantum of the VCD file
+paste -d' ' "$DIR/cycles.changes" "$DIR/vcd.changes" | awk -v f="$FILE" '
+NF != 6 {
+	bad=1
+	why="the VCD file and the cycles have different numbers of changes"
+	exit
+}
+($1 != $4) || ($3 != $6) {
+	bad=1
+	why="a change of " $1 " at quantum " $2 " differs"
+	exit
+}
+$2 > 0 && quantum == "" {
+	quantum=$5/$2
+}
+(quantum != "") && ($5 != $2*quantum) {
+	bad=1
+	why="a change of " $1 " is at " $5 "ps, not at quantum " $2
+	exit
+}
+END {
+	if(bad) {
+		print "VCD check of " f ": " why
+		exit 1
+	}
+	print "VCD check of " f ": " NR " changes at the times of the cycles"
+}'
+status=$?
+rm -f "$DIR/cycles.txt" "$DIR/out.vcd" "$DIR/cycles.changes" "$DIR/vcd.changes"
+exit $status
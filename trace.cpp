@@ -0,0 +1,120 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Trace of the processing of a STIL file; see trace.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #Lines are printed on the standard output, so that they are suppressed
+ *	with the rest of it, whilst it is suppressed
+ * #The levels are switched on before the files are processed; a file that
+ *	is being processed whilst they change may trace a mix of both
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <iostream>
+#include <stdlib.h>
+
+#include "trace.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// Initialize class variables...
+atomic<int> trace::levels[NUM_TRACE_CATEGORIES];
+mutex trace::lock;
+const char *const trace::names[NUM_TRACE_CATEGORIES]={"tokens", "header",
+	"signals", "timing", "pattern", "scan", "values", "check", "output"};
+
+/**
+ * Switch the trace on from the environment variable STIL_TRACE before main()
+ * is run; an invalid spec is ignored
+ */
+static struct trace_from_environment {
+	trace_from_environment() {
+		const char *spec=getenv("STIL_TRACE");
+		if(spec != NULL) {
+			try {
+				trace::set(spec);
+			}catch(ViolatedPrecondition &e) {
+				cerr << "STIL_TRACE: " << e.get_message() << endl;
+			}
+		}
+	}
+} environment_trace;
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to switch the categories of a spec on
+ * @param spec is a comma separated list of [category][:level]; the category
+ *	"all" stands for every category, and the level is a number from 0 (off)
+ *	to 3 (verbose), which is 2 (debug) if it is omitted
+ * @throws ViolatedPrecondition exception if a category or level is unknown
+ * @return nothing
+ */
+void trace::set(string spec) {
+	size_t start=0;
+	while(start <= spec.size()) {
+		size_t end=spec.find(',', start);
+		if(end == string::npos) {
+			end=spec.size();
+		}
+		string item=spec.substr(start, end-start);
+		start=end+1;
+		if(item.empty()) {
+			continue;
+		}
+
+		int level=TRACE_DEBUG;
+		size_t colon=item.find(':');
+		if(colon != string::npos) {
+			string digits=item.substr(colon+1);
+			if((digits.size() != 1) || (digits[0] < '0')
+				|| (digits[0] > '0'+TRACE_VERBOSE)) {
+
+				throw ViolatedPrecondition("Unknown level of the trace: "
+					+ digits);
+			}
+			level=digits[0]-'0';
+			item=item.substr(0, colon);
+		}
+
+		bool found=false;
+		for(int c=0; c<NUM_TRACE_CATEGORIES; c++) {
+			if((item == "all") || (item == names[c])) {
+				levels[c].store(level, memory_order_relaxed);
+				found=true;
+			}
+		}
+		if(!found) {
+			throw ViolatedPrecondition("Unknown category of the trace: "
+				+ item);
+		}
+	}
+}
+
+
+/**
+ * Function to print a line of the trace on the standard output
+ * Lines of different threads are not interleaved
+ * @param line is the line, without its newline
+ * @return nothing
+ */
+void trace::write(const string &line) {
+	lock_guard<mutex> lk(lock);
+	cout << line << endl;
+}
+
+
+// Function to list the names of the categories, separated by commas
+string trace::get_category_names() {
+	string s="all";
+	for(int c=0; c<NUM_TRACE_CATEGORIES; c++) {
+		s=s + "," + names[c];
+	}
+	return s;
+}
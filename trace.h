@@ -0,0 +1,94 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Trace of the processing of a STIL file, by category and level
+ * The trace is only compiled in when STIL_TRACE is defined ("make debug");
+ * otherwise, TRACE() expands to nothing, and its message is never built.
+ * When it is compiled in, each category is switched on at a level with
+ * --trace=[spec], or the environment variable STIL_TRACE, whose spec is a
+ * comma separated list of [category][:level], such as "pattern:3,values"
+ * or "all:2"; the level is 2 (debug) if it is omitted.
+ */
+
+// Import Header files from the C++ STL
+#include <string>
+#include <sstream>
+#include <atomic>
+#include <mutex>
+
+
+#ifndef __TRACE_H
+#define __TRACE_H
+using namespace std;
+
+// Categories of the trace
+enum trace_category {
+	TRACE_TOKENS,		// Tokens of the STIL file
+	TRACE_HEADER,		// Header block
+	TRACE_SIGNALS,		// Signals and SignalGroups blocks
+	TRACE_TIMING,		// Timing block and WaveformTables
+	TRACE_PATTERN,		// Pattern, Macro and V blocks
+	TRACE_SCAN,			// Procedures and scan chains
+	TRACE_VALUES,		// Values of each signal
+	TRACE_CHECK,		// Dumps of every signal between the blocks
+	TRACE_OUTPUT,		// Output file
+	NUM_TRACE_CATEGORIES
+};
+
+// Levels of the trace; a higher level prints more
+enum trace_level {
+	TRACE_OFF = 0,
+	TRACE_INFO = 1,
+	TRACE_DEBUG = 2,
+	TRACE_VERBOSE = 3
+};
+
+// =======================================================================
+
+// Class definition...
+class trace {
+	public:
+		// Is the category traced at this level?
+		static bool enabled(trace_category category, int level) {
+			return levels[category].load(memory_order_relaxed) >= level;
+		}
+		/**
+		 * Switch the categories of a spec on; an unknown category or
+		 * level throws ViolatedPrecondition
+		 */
+		static void set(string spec);
+		// Print a line of the trace on the standard output
+		static void write(const string &line);
+		// Names of the categories, for --trace
+		static string get_category_names();
+
+
+	private:
+		// Declaration of class variables...
+		static atomic<int> levels[NUM_TRACE_CATEGORIES];
+		static mutex lock;
+		static const char *const names[NUM_TRACE_CATEGORIES];
+};
+
+
+#ifdef STIL_TRACE
+/**
+ * Print a line, built from the stream expression message, if category is
+ * traced at level
+ */
+#define TRACE(category, level, message) \
+	do { \
+		if(trace::enabled(category, level)) { \
+			ostringstream trace_line; \
+			trace_line << message; \
+			trace::write(trace_line.str()); \
+		} \
+	} while(0)
+#define TRACE_ENABLED(category, level) trace::enabled(category, level)
+#else
+#define TRACE(category, level, message) do { } while(0)
+#define TRACE_ENABLED(category, level) false
+#endif
+#endif
@@ -0,0 +1,259 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Timeline of a run, in the Chrome trace event format; see trace_events.h
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #The timeline is written once every thread that recorded events is idle
+ *	or has exited; a buffer is never freed, since the thread that owns it
+ *	may still be alive
+ * #Begin and end events are balanced on each thread, by their scopes;
+ *	events that are dropped when the buffer of a thread is full may leave
+ *	a scope open until the end of the timeline
+ * #The chunks of a buffer are reserved when it is registered, so that the
+ *	events that are recorded are never moved
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <fstream>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "trace_events.h"
+#include "ViolatedPrecondition.h"
+
+using namespace std;
+
+// Initialize class variables...
+atomic<bool> trace_events::started(false);
+int64_t trace_events::start_time=0;
+mutex trace_events::registry_lock;
+vector<trace_events::thread_buffer *> trace_events::buffers;
+thread_local trace_events::thread_buffer *trace_events::local=NULL;
+
+
+// Function to read the monotonic clock, in nanoseconds
+static int64_t now_ns() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec*1000000000LL+ts.tv_nsec;
+}
+
+
+/**
+ * Function to append a string as a JSON string
+ * @param line is appended the JSON string
+ * @param s is the string
+ * @return nothing
+ */
+static void append_json_string(string &line, const char *s) {
+	static const char digits[]="0123456789abcdef";
+	line += '"';
+	for(; *s != '\0'; s++) {
+		if((*s == '"') || (*s == '\\')) {
+			line += '\\';
+			line += *s;
+		}else if((unsigned char)*s < 0x20) {
+			line += "\\u00";
+			line += digits[(*s >> 4) & 0xf];
+			line += digits[*s & 0xf];
+		}else{
+			line += *s;
+		}
+	}
+	line += '"';
+}
+
+
+/**
+ * Function to append a time in nanoseconds as microseconds, with three
+ * decimals
+ * @param line is appended the time
+ * @param ns is the time, in nanoseconds; it is not negative
+ * @return nothing
+ */
+static void append_microseconds(string &line, int64_t ns) {
+	line += to_string(ns/1000);
+	char fraction[5]={'.', (char)('0'+(ns/100)%10), (char)('0'+(ns/10)%10),
+		(char)('0'+ns%10), '\0'};
+	line += fraction;
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+// Function to start recording the timeline; it is started once
+void trace_events::start() {
+	if(!started.load()) {
+		start_time=now_ns();
+		started.store(true);
+	}
+}
+
+
+/**
+ * Function to get the buffer of this thread
+ * The buffer is registered under the lock when the thread records its first
+ * event; every other event is appended without any lock
+ * @return the buffer
+ */
+trace_events::thread_buffer *trace_events::get_buffer() {
+	if(local == NULL) {
+		thread_buffer *b=new thread_buffer();
+		b->name=NULL;
+		b->index=-1;
+		b->chunks.reserve(MAX_CHUNKS);
+		b->num_events.store(0);
+		b->num_dropped=0;
+		lock_guard<mutex> lk(registry_lock);
+		b->tid=buffers.size()+1;
+		buffers.push_back(b);
+		local=b;
+	}
+	return local;
+}
+
+
+/**
+ * Function to append an event to the buffer of this thread
+ * The event is published with a release store of the number of events
+ * @param name is the kind of a begin event; NULL for an end event
+ * @param detail is the detail of a begin event; NULL if it has none
+ * @return nothing
+ */
+void trace_events::append(const char *name, const char *detail) {
+	thread_buffer *b=get_buffer();
+	size_t n=b->num_events.load(memory_order_relaxed);
+	size_t c=n/CHUNK_EVENTS;
+	if(c >= b->chunks.size()) {
+		if(c >= (size_t)MAX_CHUNKS) {
+			b->num_dropped++;
+			return;
+		}
+		b->chunks.push_back(new event[CHUNK_EVENTS]);
+	}
+
+	event &e=b->chunks[c][n%CHUNK_EVENTS];
+	e.time=now_ns()-start_time;
+	e.name=name;
+	if(detail != NULL) {
+		strncpy(e.detail, detail, MAX_DETAIL);
+		e.detail[MAX_DETAIL]='\0';
+	}else{
+		e.detail[0]='\0';
+	}
+	b->num_events.store(n+1, memory_order_release);
+}
+
+
+/**
+ * Function to record a begin event on this thread
+ * @param name is the kind of the event, such as "v" or "task"; it must
+ *	outlive the timeline
+ * @param detail is its detail, such as the name of a Macro; NULL if none
+ * @return nothing
+ */
+void trace_events::begin(const char *name, const char *detail) {
+	append(name, detail);
+}
+
+
+// Function to record the end event of the innermost begin event
+void trace_events::end() {
+	append(NULL, NULL);
+}
+
+
+/**
+ * Function to name this thread in the timeline, if it is being recorded
+ * @param name is the name of the thread; it must outlive the timeline
+ * @param index is the index of the thread amongst its kind; negative if
+ *	there is only one
+ * @return nothing
+ */
+void trace_events::set_thread_name(const char *name, int index) {
+	if(!is_started()) {
+		return;
+	}
+	thread_buffer *b=get_buffer();
+	b->name=name;
+	b->index=index;
+}
+
+
+/**
+ * Function to write the timeline of every thread to a file
+ * Each thread is named by a metadata event; the times are in microseconds
+ * since the start of the timeline
+ * @param filename is the name of the file
+ * @throws ViolatedPrecondition exception if the file cannot be written
+ * @return nothing
+ */
+void trace_events::write(string filename) {
+	ofstream out(filename.c_str());
+	if(!out.is_open()) {
+		throw ViolatedPrecondition("Timeline cannot be written to "
+			+ filename);
+	}
+
+	int pid=getpid();
+	lock_guard<mutex> lk(registry_lock);
+	out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" << endl;
+	out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+		<< ",\"args\":{\"name\":\"parse.out\"}}";
+	for(size_t i=0; i<buffers.size(); i++) {
+		thread_buffer *b=buffers[i];
+		out << "," << endl << "{\"name\":\"thread_name\",\"ph\":\"M\","
+			<< "\"pid\":" << pid << ",\"tid\":" << b->tid
+			<< ",\"args\":{\"name\":\"";
+		if(b->name == NULL) {
+			out << ((b->tid == 1) ? "main" : "thread") << "\"}}";
+		}else{
+			out << b->name;
+			if(b->index >= 0) {
+				out << " " << b->index;
+			}
+			out << "\"}}";
+		}
+		if(b->num_dropped > 0) {
+			out << "," << endl << "{\"name\":\"dropped events\",\"ph\":\"i\","
+				<< "\"s\":\"t\",\"pid\":" << pid << ",\"tid\":" << b->tid
+				<< ",\"ts\":0,\"args\":{\"count\":" << b->num_dropped << "}}";
+		}
+
+		/**
+		 * The events are formatted into a line of their own, without the
+		 * stream, which would format each number through its locale
+		 */
+		string prefix=",\n{\"pid\":" + to_string(pid) + ",\"tid\":"
+			+ to_string(b->tid) + ",\"ph\":\"";
+		string line;
+		size_t n=b->num_events.load(memory_order_acquire);
+		for(size_t k=0; k<n; k++) {
+			const event &e=b->chunks[k/CHUNK_EVENTS][k%CHUNK_EVENTS];
+			line=prefix;
+			line += (e.name != NULL) ? "B\",\"ts\":" : "E\",\"ts\":";
+			append_microseconds(line, e.time);
+			if(e.name != NULL) {
+				line += ",\"name\":";
+				append_json_string(line, e.name);
+				if(e.detail[0] != '\0') {
+					line += ",\"args\":{\"detail\":";
+					append_json_string(line, e.detail);
+					line += "}";
+				}
+			}
+			line += "}";
+			out.write(line.data(), line.size());
+		}
+	}
+	out << endl << "]}" << endl;
+	if(!out) {
+		throw ViolatedPrecondition("Timeline cannot be written to "
+			+ filename);
+	}
+}
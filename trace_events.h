@@ -0,0 +1,126 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Timeline of a run, in the Chrome trace event format (--trace-events)
+ * Each thread records the begin and end events of its phases, Macros,
+ * procedures, jobs of the thread pool, batches of the pipeline and stalls
+ * of its rings into its own buffer, which only that thread appends to, so
+ * that no lock is taken once its buffer is registered. The events of every
+ * thread are written as a JSON file when the run is finished, to be viewed
+ * in Perfetto (ui.perfetto.dev) or chrome://tracing. Nothing is recorded
+ * unless the timeline is started.
+ */
+
+// Import Header files from the C++ STL
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+
+
+#ifndef __TRACE_EVENTS_H
+#define __TRACE_EVENTS_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class trace_events {
+	public:
+		// Initialize constants...
+		// Number of events in each chunk of the buffer of a thread
+		static const int CHUNK_EVENTS = 16384;
+		// Maximum number of chunks of a thread; later events are dropped
+		static const int MAX_CHUNKS = 4096;
+		// Maximum length of the detail of an event; it is truncated
+		static const int MAX_DETAIL = 23;
+
+		/**
+		 * Guard that records the begin event of its scope, and its end
+		 * event, if the timeline is started
+		 */
+		class scope {
+			public:
+				scope(const char *name, const char *detail=NULL)
+					: recorded(is_started()) {
+					if(recorded) {
+						begin(name, detail);
+					}
+				}
+				~scope() {
+					if(recorded) {
+						end();
+					}
+				}
+
+			private:
+				bool recorded;
+				// Copy constructor and assignment are not supported
+				scope(const scope &);
+				scope &operator=(const scope &);
+		};
+
+		// Define headers for functions...
+		// Start recording; the times of the events are relative to now
+		static void start();
+		// Is the timeline being recorded?
+		static bool is_started() {
+			return started.load(memory_order_relaxed);
+		}
+		/**
+		 * Record a begin event on this thread, with the name of its kind
+		 * (a string literal) and an optional detail (such as the name of a
+		 * Macro), and the end event of the innermost begin event
+		 */
+		static void begin(const char *name, const char *detail=NULL);
+		static void end();
+		// Name this thread in the timeline (a string literal), and its index
+		static void set_thread_name(const char *name, int index=-1);
+		/**
+		 * Write the events of every thread to a file, as a JSON object
+		 * @throws ViolatedPrecondition if the file cannot be written
+		 */
+		static void write(string filename);
+
+
+	private:
+		// Event of the timeline
+		struct event {
+			// Time, in nanoseconds since the start
+			int64_t time;
+			// Kind of the event; NULL for an end event
+			const char *name;
+			// Detail of a begin event; empty if there is none
+			char detail[MAX_DETAIL+1];
+		};
+		/**
+		 * Buffer of the events of a thread: chunks of events, the number of
+		 * events that are recorded, and that are dropped for want of chunks
+		 */
+		struct thread_buffer {
+			int tid;
+			const char *name;
+			int index;
+			vector<event *> chunks;
+			atomic<size_t> num_events;
+			uint64_t num_dropped;
+		};
+
+		// Declaration of class variables...
+		static atomic<bool> started;
+		static int64_t start_time;
+		// Buffers of every thread, which are registered under the lock
+		static mutex registry_lock;
+		static vector<thread_buffer *> buffers;
+		// Buffer of this thread; NULL until its first event
+		static thread_local thread_buffer *local;
+
+		// Buffer of this thread, which is registered if it is not yet
+		static thread_buffer *get_buffer();
+		// Append an event to the buffer of this thread
+		static void append(const char *name, const char *detail);
+};
+#endif
@@ -0,0 +1,279 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Writer of Value Change Dump (VCD) files
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #The time scale of the file is 1ps; the time of a change is the index of
+ *	its quantum of time multiplied by the quantum
+ * #Each value of a cycle takes a quantum of time, and a cycle lasts as long
+ *	as the signal with the most values in it; so a change is at the start
+ *	of its cycle, plus its offset within the cycle
+ * #A signal keeps its last value after its timeline has ended, since the
+ *	timelines of the signals may differ in length
+ *
+ * Reference:
+ * #IEEE Standard for Verilog Hardware Description Language,
+ *	IEEE Std 1364-2005, Section 18: Value change dump (VCD) files
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <stdlib.h>
+#include <string.h>
+#include <queue>
+#include <functional>
+#include <utility>
+
+#include "vcd_writer.h"
+#include "ViolatedAssertion.h"
+
+using namespace std;
+
+// Time of the next change of a signal, and the index of that signal
+typedef pair<uint64_t, int> vcd_event;
+
+// =======================================================================
+
+/**
+ * Standard constructor
+ * @param values is the values of the signal, from the first cycle
+ * @param index is the cycle index: the number of values of each signal at
+ *	the start of every cycle, and at the end of the last one
+ * @param num_signals is the number of signals (columns) of the index
+ * @param column is the column of the signal
+ * @param starts is the start of each cycle, and the end of the last one,
+ *	in quanta of time
+ */
+string_timeline::string_timeline(const string &values,
+	const vector<uint64_t> &index, int num_signals, int column,
+	const vector<uint64_t> &starts)
+	: vals(values), cycle_index(index), cycle_starts(starts) {
+
+	num_sigs=num_signals;
+	col=column;
+	pos=0;
+	cycle=0;
+	current=signalZ::LOGIC_UNDEFINED;
+}
+
+
+/**
+ * Function to obtain the number of values of the signal before a cycle
+ * The index counts the values from the start of the pattern, including the
+ * values before the first cycle of a slice, which are not held
+ * @param c is the cycle
+ * @return the number of values before the cycle, within the values
+ */
+uint64_t string_timeline::values_before(uint64_t c) {
+	return cycle_index[c*num_sigs+col]-cycle_index[col];
+}
+
+
+/**
+ * Function to scan the values for the next change
+ * @param t is assigned the quantum of time of the value that changes: the
+ *	start of its cycle, and its offset within the cycle
+ * @param value is assigned the LOGIC_* code of the new value
+ * @return true if there is another change; else, return false
+ * O(n+c) computational time complexity over the whole timeline, for n
+ * values in c cycles
+ */
+bool string_timeline::next_change(uint64_t &t, int &value) {
+	// Index of the last cycle, which ends the timeline
+	uint64_t last=cycle_starts.size()-1;
+	while(pos < vals.size()) {
+		int v=signalZ::logic_code(vals[pos]);
+		if(v != current) {
+			// Find the cycle of the value
+			while((cycle < last) && (values_before(cycle+1) <= pos)) {
+				cycle++;
+			}
+			current=v;
+			t=cycle_starts[cycle]+(pos-values_before(cycle));
+			value=v;
+			pos++;
+			return true;
+		}
+		pos++;
+	}
+	return false;
+}
+
+
+// Quantum of time at the end of the last cycle
+uint64_t string_timeline::get_end() {
+	return cycle_starts.back();
+}
+
+// =======================================================================
+
+// Standard constructor
+vcd_writer::vcd_writer(output_buffer &out) : outputfile(out) {
+	quantum=1;
+}
+
+// Destructor
+vcd_writer::~vcd_writer() {
+	for(size_t i=0; i<cursors.size(); i++) {
+		delete cursors[i];
+	}
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+// Set the quantization unit of time in picoseconds
+void vcd_writer::set_quantum(uint64_t quantum_ps) {
+	quantum=quantum_ps;
+}
+
+// Set the test date from the Header block
+void vcd_writer::set_date(string d) {
+	date=d;
+}
+
+/**
+ * Function to add a signal to the file
+ * @param name is the name of the signal
+ * @param cursor is the cursor over its timeline; it is deleted by this writer
+ * @return nothing
+ */
+void vcd_writer::add_signal(string name, timeline_cursor *cursor) {
+	names.push_back(name);
+	ids.push_back(id_code(names.size()-1));
+	cursors.push_back(cursor);
+}
+
+
+/**
+ * Function to convert a LOGIC_* code into its character in a VCD file
+ * @param logic is the LOGIC_* code
+ * @return 0, 1, z or x
+ */
+char vcd_writer::vcd_char(int logic) {
+	switch(logic) {
+		case signalZ::LOGIC_ZERO:
+			return '0';
+		case signalZ::LOGIC_ONE:
+			return '1';
+		case signalZ::LOGIC_HIGH_IMPEDANCE:
+			return 'z';
+		default:
+			return 'x';
+	}
+}
+
+
+/**
+ * Function to obtain the identifier code of the n^{th} signal
+ * Identifier codes are made of the printable characters "!" to "~"
+ * @param n is the index of the signal
+ * @return its identifier code
+ */
+string vcd_writer::id_code(int n) {
+	string id;
+	do {
+		id += (char)('!' + (n%94));
+		n=n/94;
+	} while(n > 0);
+	return id;
+}
+
+
+// Write a time stamp, in picoseconds
+void vcd_writer::write_time(uint64_t t) {
+	char buf[32];
+	int n=snprintf(buf, sizeof(buf), "#%llu\n", (unsigned long long)(t*quantum));
+	outputfile.write(buf, n);
+}
+
+
+// Write a change in the value of a signal
+void vcd_writer::write_change(int sig, int value) {
+	outputfile.put(vcd_char(value));
+	outputfile.write(ids[sig]);
+	outputfile.put('\n');
+}
+
+
+/**
+ * Function to write the file
+ * The next change of every signal is kept in a min-heap; the earliest
+ * changes are written, and the timelines of those signals are advanced
+ * @return nothing
+ * O(n log k) computational time complexity, for n changes of k signals
+ */
+void vcd_writer::write() {
+	// Definitions of the file...
+	if(!date.empty()) {
+		outputfile.write("$date\n\t"+date+"\n$end\n");
+	}
+	outputfile.write("$version\n\tLombardia-STIL parse.out\n$end\n");
+	outputfile.write("$timescale 1ps $end\n");
+	outputfile.write("$scope module stil $end\n");
+	for(size_t i=0; i<names.size(); i++) {
+		outputfile.write("$var wire 1 "+ids[i]+" "+names[i]+" $end\n");
+	}
+	outputfile.write("$upscope $end\n$enddefinitions $end\n");
+
+	// Heap of the next change of each signal; earliest change first
+	priority_queue<vcd_event, vector<vcd_event>, greater<vcd_event> > heap;
+	// Values of the pending changes
+	vector<int> pending(names.size(), (int)signalZ::LOGIC_UNDEFINED);
+	// End of the longest timeline
+	uint64_t end=0;
+	uint64_t t;
+	int value;
+
+	for(size_t i=0; i<cursors.size(); i++) {
+		if(cursors[i]->next_change(t, value)) {
+			pending[i]=value;
+			heap.push(vcd_event(t, i));
+		}
+		if(cursors[i]->get_end() > end) {
+			end=cursors[i]->get_end();
+		}
+	}
+
+	// Values at time 0 are written in $dumpvars; the others are unknown
+	outputfile.write("#0\n$dumpvars\n");
+	vector<bool> at_zero(names.size(), false);
+	while((!heap.empty()) && (heap.top().first == 0)) {
+		int sig=heap.top().second;
+		heap.pop();
+		at_zero[sig]=true;
+		write_change(sig, pending[sig]);
+		if(cursors[sig]->next_change(t, value)) {
+			pending[sig]=value;
+			heap.push(vcd_event(t, sig));
+		}
+	}
+	for(size_t i=0; i<names.size(); i++) {
+		if(!at_zero[i]) {
+			write_change(i, signalZ::LOGIC_UNDEFINED);
+		}
+	}
+	outputfile.write("$end\n");
+
+	// Merge the changes of all signals in time order
+	while(!heap.empty()) {
+		uint64_t now=heap.top().first;
+		write_time(now);
+		while((!heap.empty()) && (heap.top().first == now)) {
+			int sig=heap.top().second;
+			heap.pop();
+			write_change(sig, pending[sig]);
+			if(cursors[sig]->next_change(t, value)) {
+				pending[sig]=value;
+				heap.push(vcd_event(t, sig));
+			}
+		}
+	}
+
+	// Time stamp at the end of the longest timeline
+	write_time(end);
+	outputfile.flush();
+}
@@ -0,0 +1,130 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Writer of Value Change Dump (VCD) files, for waveform viewers such as
+ * GTKWave
+ * Only the changes in the values of the signals are written. The timelines
+ * of all signals are merged in time order with a k-way merge, so that each
+ * timeline is read once, and sequentially. The signals are in the scope
+ * "stil".
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "output_buffer.h"
+#include "signalZ.h"
+
+
+#ifndef __VCD_WRITER_H
+#define __VCD_WRITER_H
+using namespace std;
+
+// =======================================================================
+
+/**
+ * Cursor over the timeline of a signal, which yields each change in its
+ * values in time order
+ * A timeline that is stored as runs or as events yields its runs or events
+ * directly; a timeline that is stored as a value for each quantum of time
+ * is scanned for its changes.
+ */
+class timeline_cursor {
+	public:
+		virtual ~timeline_cursor() {}
+		/**
+		 * Obtain the next change of the value
+		 * @param t is assigned the index of the quantum of time of the change
+		 * @param value is assigned the LOGIC_* code of the new value
+		 * @return true if there is another change; else, return false
+		 */
+		virtual bool next_change(uint64_t &t, int &value) = 0;
+		// Index of the quantum of time after the last value
+		virtual uint64_t get_end() = 0;
+};
+
+
+/**
+ * Cursor over a timeline that holds the values of a signal in each cycle
+ * The values of a cycle take a quantum of time each, from the start of the
+ * cycle; the cycles of a signal are delimited by the cycle index, which
+ * holds the number of values of each signal at the start of every cycle.
+ */
+class string_timeline : public timeline_cursor {
+	public:
+		string_timeline(const string &values, const vector<uint64_t> &index,
+			int num_signals, int column, const vector<uint64_t> &starts);
+		bool next_change(uint64_t &t, int &value);
+		uint64_t get_end();
+
+	private:
+		// Values of the signal
+		const string &vals;
+		// Cycle index, of num_signals columns, and the column of the signal
+		const vector<uint64_t> &cycle_index;
+		int num_sigs;
+		int col;
+		// Start of each cycle, and the end of the last, in quanta of time
+		const vector<uint64_t> &cycle_starts;
+		// Index of the next value to be scanned, and the cycle that it is in
+		uint64_t pos;
+		uint64_t cycle;
+		// LOGIC_* code of the most recent value; unknown before the first
+		int current;
+
+		// Number of values of the signal before a cycle, within the values
+		uint64_t values_before(uint64_t c);
+};
+
+
+// Class definition...
+class vcd_writer {
+	public:
+		// Standard Constructor...
+		vcd_writer(output_buffer &out);
+		// Destructor; deletes the cursors of the timelines
+		~vcd_writer();
+
+		// Define headers for functions...
+		// Set the quantization unit of time in picoseconds
+		void set_quantum(uint64_t quantum_ps);
+		// Set the test date from the Header block
+		void set_date(string date);
+		// Add a signal and the cursor over its timeline; it is deleted later
+		void add_signal(string name, timeline_cursor *cursor);
+		// Write the file
+		void write();
+
+		// Character of a LOGIC_* code in a VCD file: 0, 1, z or x
+		static char vcd_char(int logic);
+
+
+	private:
+		// Declaration of instance variables...
+		// Output file
+		output_buffer &outputfile;
+		// Quantization unit of time in picoseconds
+		uint64_t quantum;
+		// Test date
+		string date;
+		// Names, identifiers and timelines of the signals
+		vector<string> names;
+		vector<string> ids;
+		vector<timeline_cursor *> cursors;
+
+		// Identifier code of the n^{th} signal
+		static string id_code(int n);
+		// Write a time stamp, in picoseconds
+		void write_time(uint64_t t);
+		// Write a change in the value of a signal
+		void write_change(int sig, int value);
+		// Copy constructor and assignment are not supported
+		vcd_writer(const vcd_writer &);
+		vcd_writer &operator=(const vcd_writer &);
+};
+#endif
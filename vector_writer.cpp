@@ -0,0 +1,276 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Writer of the vector-major (WGL-style) table
+ *
+ * IMPORTANT ASSUMPTIONS:
+ * #The i^{th} character of each row is the value of the i^{th} signal, in
+ *	the order of the names on the second line of the table
+ * #Each cycle has a row for each value of the signal with the most values
+ *	in the cycle; signals with fewer values in the cycle are padded with
+ *	PAD_VALUE, so that the rows of a cycle never hold values of another
+ * #The cycle index counts the values from the start of the pattern, which
+ *	includes the values before the first cycle of a slice, which are not
+ *	held
+ * #The squares of 8 signals by 8 rows are transposed in 8-byte words,
+ *	which assumes a little-endian machine; on other machines, the values
+ *	are copied a value at a time
+ */
+
+// Import Header files from the C++ STL and the directory
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+
+#include "vector_writer.h"
+#include "ViolatedAssertion.h"
+
+using namespace std;
+
+// =======================================================================
+
+// Standard constructor
+vector_writer::vector_writer(output_buffer &out) : outputfile(out) {
+	cycle_index=NULL;
+	// Is the first byte of a word its least significant byte?
+	uint16_t one=1;
+	little_endian=(*((unsigned char *)&one) == 1);
+}
+
+// =======================================================================
+
+// Implement function definitions...
+
+/**
+ * Function to add a signal to the table
+ * @param name is the name of the signal
+ * @param vals are the values of the signal; they are read in place
+ * @return nothing
+ */
+void vector_writer::add_signal(string name, const string &vals) {
+	names.push_back(name);
+	values.push_back(vals.data());
+}
+
+
+/**
+ * Function to set the cycle index of the signals
+ * @param index is the number of values of each signal, in the order that
+ *	they are added, at the start of every cycle and at the end of the last
+ * @return nothing
+ */
+void vector_writer::set_cycle_index(const vector<uint64_t> &index) {
+	cycle_index=&index;
+}
+
+
+/**
+ * Function to transpose a square of 8 signals by 8 rows
+ * The values of the 8 signals are loaded as 8-byte words, and swapped in
+ * blocks of 4, 2 and 1 bytes; each word then holds a row of the square
+ * @param src are the values of the 8 signals, from the first row
+ * @param dst is the first row of the square in the buffer of the block
+ * @param row_size is the distance between two rows in the buffer
+ * @return nothing
+ * O(1) computational time complexity
+ */
+void vector_writer::transpose_8x8(const char *src[8], char *dst, size_t row_size) {
+	uint64_t x[8];
+	for(int i=0; i<8; i++) {
+		memcpy(&x[i], src[i], 8);
+	}
+
+	uint64_t t;
+	for(int i=0; i<4; i++) {
+		t=((x[i] >> 32) ^ x[i+4]) & 0x00000000FFFFFFFFULL;
+		x[i]=x[i] ^ (t << 32);
+		x[i+4]=x[i+4] ^ t;
+	}
+	for(int i=0; i<8; i=i+4) {
+		for(int j=i; j<i+2; j++) {
+			t=((x[j] >> 16) ^ x[j+2]) & 0x0000FFFF0000FFFFULL;
+			x[j]=x[j] ^ (t << 16);
+			x[j+2]=x[j+2] ^ t;
+		}
+	}
+	for(int i=0; i<8; i=i+2) {
+		t=((x[i] >> 8) ^ x[i+1]) & 0x00FF00FF00FF00FFULL;
+		x[i]=x[i] ^ (t << 8);
+		x[i+1]=x[i+1] ^ t;
+	}
+
+	for(int i=0; i<8; i++) {
+		memcpy(dst+i*row_size, &x[i], 8);
+	}
+}
+
+
+/**
+ * Function to transpose rows into the buffer of a block
+ * The rows are visited a tile of TILE_PINS signals by TILE_ROWS rows at a
+ * time, so that the values that are read and the rows that are written by
+ * a tile both stay in the L1 cache. Within a tile, squares of 8 signals by
+ * 8 rows are transposed in registers; the values next to the end of a
+ * signal, and the last signals of the block, are copied a value at a time.
+ * The values of each signal are at src, and avail holds their number, up
+ * to n; the rows after them are padded.
+ * @param n is the number of rows
+ * @param block is the first of the rows in the buffer of the block; each
+ *	row ends with a newline
+ * @return nothing
+ * O(n) computational time complexity, for n values in the rows
+ */
+void vector_writer::transpose_rows(size_t n, char *block) {
+	size_t num_pins=names.size();
+	size_t row_size=num_pins+1;
+
+	for(size_t tile=0; tile<num_pins; tile=tile+TILE_PINS) {
+		size_t tile_end=tile+TILE_PINS;
+		if(tile_end > num_pins) {
+			tile_end=num_pins;
+		}
+
+		for(size_t r=0; r<n; r=r+TILE_ROWS) {
+			size_t r_end=r+TILE_ROWS;
+			if(r_end > n) {
+				r_end=n;
+			}
+
+			for(size_t pin=tile; pin<tile_end; pin=pin+8) {
+				size_t pin_end=pin+8;
+				if(pin_end > tile_end) {
+					pin_end=tile_end;
+				}
+				// Rows of the tile that all 8 signals hold values for
+				size_t full=r;
+				if(little_endian && (pin_end == (pin+8))) {
+					full=r_end;
+					for(size_t p=pin; p<pin_end; p++) {
+						if(avail[p] < full) {
+							full=avail[p];
+						}
+					}
+					if(full < r) {
+						full=r;
+					}
+					full=r+((full-r)/8)*8;
+				}
+
+				size_t t=r;
+				for(; t<full; t=t+8) {
+					const char *s[8];
+					for(int i=0; i<8; i++) {
+						s[i]=src[pin+i]+t;
+					}
+					transpose_8x8(s, block+t*row_size+pin, row_size);
+				}
+				// Copy the remaining rows a value at a time
+				for(size_t p=pin; p<pin_end; p++) {
+					char *dst=block+t*row_size+p;
+					for(size_t u=t; u<r_end; u++) {
+						*dst=(u < avail[p]) ? src[p][u] : PAD_VALUE;
+						dst=dst+row_size;
+					}
+				}
+			}
+		}
+	}
+
+	// End each row of the block
+	for(size_t t=0; t<n; t++) {
+		block[t*row_size+num_pins]='\n';
+	}
+}
+
+
+/**
+ * Function to write the table
+ * The names of the signals are written on a line, followed by a row of
+ * all signals for each quantum of time of each cycle. The rows of the
+ * cycles are gathered in a block; a cycle with more rows than a block is
+ * split across blocks.
+ * @throws ViolatedAssertion exception if there is no cycle index, or if
+ *	the buffer cannot be allocated
+ * @return nothing
+ * O(n+c*k) computational time complexity, for n values in c cycles of k
+ * signals
+ */
+void vector_writer::write() {
+	outputfile.write(">>>Vector-major values of the input and output signals\n");
+	outputfile.write("signals");
+	for(size_t i=0; i<names.size(); i++) {
+		outputfile.put('\t');
+		outputfile.write(names[i]);
+	}
+	outputfile.put('\n');
+
+	size_t num_pins=names.size();
+	if(num_pins == 0) {
+		outputfile.flush();
+		return;
+	}
+	if((cycle_index == NULL) || ((cycle_index->size()%num_pins) != 0)) {
+		throw ViolatedAssertion("Cycle index does not match the signals");
+	}
+	const vector<uint64_t> &index=*cycle_index;
+	size_t num_cycles=(index.size() > 0) ? (index.size()/num_pins-1) : 0;
+
+	// Number of rows in a block, which is a multiple of TILE_ROWS
+	size_t row_size=num_pins+1;
+	size_t block_rows=((BLOCK_BYTES/row_size)/TILE_ROWS)*TILE_ROWS;
+	if(block_rows < TILE_ROWS) {
+		block_rows=TILE_ROWS;
+	}else if(block_rows > BLOCK_INTERVALS) {
+		block_rows=BLOCK_INTERVALS;
+	}
+	// Buffer that holds the rows of a block
+	char *block=(char *)malloc(block_rows*row_size);
+	if(block == NULL) {
+		throw ViolatedAssertion("Buffer of vector-major rows cannot be allocated");
+	}
+
+	src.assign(num_pins, (const char *)NULL);
+	avail.assign(num_pins, 0);
+	// Number of rows of the block that are filled
+	size_t used=0;
+	for(size_t c=0; c<num_cycles; c++) {
+		const uint64_t *start=&index[c*num_pins];
+		const uint64_t *end=start+num_pins;
+		// Number of rows of the cycle
+		size_t rows=0;
+		for(size_t p=0; p<num_pins; p++) {
+			if(end[p]-start[p] > rows) {
+				rows=end[p]-start[p];
+			}
+		}
+
+		// Rows [r, r+n) of the cycle are transposed into the block
+		for(size_t r=0; r<rows; ) {
+			size_t n=rows-r;
+			if(n > block_rows-used) {
+				n=block_rows-used;
+			}
+			for(size_t p=0; p<num_pins; p++) {
+				size_t count=end[p]-start[p];
+				src[p]=values[p]+(start[p]-index[p])+r;
+				avail[p]=(count > r) ? min(count-r, n) : 0;
+			}
+			transpose_rows(n, block+used*row_size);
+			used=used+n;
+			r=r+n;
+			if(used == block_rows) {
+				outputfile.write(block, used*row_size);
+				used=0;
+			}
+		}
+	}
+	if(used > 0) {
+		outputfile.write(block, used*row_size);
+	}
+
+	free(block);
+	outputfile.flush();
+}
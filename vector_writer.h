@@ -0,0 +1,87 @@
+/**
+ * This is written by Zhiyang Ong to parse a STIL file into a FLAT tabular
+ * test pattern format that contains input test patterns for execution on
+ * automatic test equipment
+ *
+ * Writer of the vector-major (WGL-style) table, which holds a row of all
+ * signals for each quantum of time
+ * The values of each signal are stored as a single string; these strings
+ * are transposed into rows a tile at a time, so that neither the strings
+ * nor the rows are walked with a large stride. The tiles are aligned on the
+ * cycles of the cycle index, so that a row never holds the values of two
+ * cycles.
+ */
+
+// Import Header files from the C++ STL
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "output_buffer.h"
+
+
+#ifndef __VECTOR_WRITER_H
+#define __VECTOR_WRITER_H
+using namespace std;
+
+// =======================================================================
+
+// Class definition...
+class vector_writer {
+	public:
+		// Initialize constants...
+		/**
+		 * Number of rows (quanta of time) that are transposed at a time; it
+		 * is reduced for wide rows, so that the block fits in BLOCK_BYTES
+		 */
+		static const size_t BLOCK_INTERVALS = 4096;
+		// Size of the buffer of a block, which should fit in the L2 cache
+		static const size_t BLOCK_BYTES = 1024*1024;
+		// Number of signals and rows in a tile of a block
+		static const size_t TILE_PINS = 64;
+		static const size_t TILE_ROWS = 64;
+		// Value of a signal in the rows of a cycle after its last value
+		static const char PAD_VALUE = '-';
+
+		// Standard Constructor...
+		vector_writer(output_buffer &out);
+
+		// Define headers for functions...
+		// Add a signal; its values must not change until they are written
+		void add_signal(string name, const string &values);
+		/**
+		 * Set the cycle index: the number of values of each signal at the
+		 * start of every cycle, and at the end of the last one; it must not
+		 * change until the table is written
+		 */
+		void set_cycle_index(const vector<uint64_t> &index);
+		// Write the names of the signals and the rows
+		void write();
+
+
+	private:
+		// Declaration of instance variables...
+		// Output file
+		output_buffer &outputfile;
+		// Names and values of the signals
+		vector<string> names;
+		vector<const char *> values;
+		// Cycle index, with a column for each signal
+		const vector<uint64_t> *cycle_index;
+		// First value of each signal in the rows, and the number of them
+		vector<const char *> src;
+		vector<size_t> avail;
+		// Can squares of values be transposed in 8-byte words?
+		bool little_endian;
+
+		// Transpose a square of 8 signals by 8 rows
+		static void transpose_8x8(const char *src[8], char *dst, size_t row_size);
+		// Transpose n rows of the values at src into the buffer of a block
+		void transpose_rows(size_t n, char *block);
+		// Copy constructor and assignment are not supported
+		vector_writer(const vector_writer &);
+		vector_writer &operator=(const vector_writer &);
+};
+#endif